@@ -0,0 +1,24 @@
+// file: poll.c
+#include <pico.h>
+
+int main() {
+    pico_init(1);
+    pico_set_expert(1);
+
+    Pico_Pos pos = { 32, 18 };
+    while (!pico_get_key_pressed(PICOK_ESCAPE)) {
+        pico_input_poll();
+        if (pico_get_key(PICOK_LEFT))  pos.x--;
+        if (pico_get_key(PICOK_RIGHT)) pos.x++;
+        if (pico_get_mouse_pressed(SDL_BUTTON_LEFT)) {
+            pos = pico_get_mouse();
+        }
+        pico_output_clear();
+        pico_output_draw_pixel(pos);
+        pico_output_present();
+        pico_input_delay(16);
+    }
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "hash.h"
+#include "pak.h"
+
+typedef struct pico_pak_head {
+    char magic[4];
+    uint32_t version;
+    uint32_t n;
+    uint32_t pad;
+} pico_pak_head;
+
+struct pico_pak {
+    const char* buf;
+    size_t size;
+    pico_hash* index;
+};
+
+// Maps the whole archive, prefetching it in a single sequential read where
+// the system allows, or reads it into memory otherwise.
+static const char* _pico_pak_map (const char* path, size_t* size) {
+#ifdef _WIN32
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* buf = malloc(*size);
+    if (buf!=NULL && fread(buf,1,*size,f)!=*size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd,&st)==-1 || st.st_size==0) {
+        close(fd);
+        return NULL;
+    }
+    *size = st.st_size;
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+    void* buf = mmap(NULL, *size, PROT_READ, flags, fd, 0);
+    close(fd);
+    return (buf == MAP_FAILED) ? NULL : buf;
+#endif
+}
+
+static void _pico_pak_unmap (const char* buf, size_t size) {
+#ifdef _WIN32
+    free((char*)buf);
+#else
+    munmap((void*)buf, size);
+#endif
+}
+
+pico_pak* pico_pak_open (const char* path) {
+    size_t size;
+    const char* buf = _pico_pak_map(path, &size);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    const pico_pak_head* head = (const pico_pak_head*) buf;
+    if (size < sizeof(pico_pak_head) ||
+        memcmp(head->magic, PICO_PAK_MAGIC, 4) != 0 ||
+        head->version != PICO_PAK_VERSION ||
+        head->n > (size-sizeof(pico_pak_head)) / sizeof(pico_pak_ent)
+    ) {
+        _pico_pak_unmap(buf, size);
+        return NULL;
+    }
+
+    pico_pak* pak = malloc(sizeof(pico_pak));
+    if (pak == NULL) {
+        _pico_pak_unmap(buf, size);
+        return NULL;
+    }
+    pak->buf = buf;
+    pak->size = size;
+    pak->index = pico_hash_create(head->n + 1);
+    if (pak->index == NULL) {
+        pico_pak_close(pak);
+        return NULL;
+    }
+
+    const pico_pak_ent* ents = (const pico_pak_ent*) (head + 1);
+    for (uint32_t i=0; i<head->n; i++) {
+        const pico_pak_ent* e = &ents[i];
+        if (e->name >= size || memchr(buf+e->name, '\0', size-e->name) == NULL ||
+            e->off > size || e->size > size-e->off ||
+            (e->type == PICO_PAK_RGBA &&
+             (e->w == 0 || e->h == 0 || 4*(uint64_t)e->w*e->h > e->size))
+        ) {
+            pico_pak_close(pak);
+            return NULL;
+        }
+        pico_hash_add(pak->index, buf+e->name, (void*)e);
+    }
+    return pak;
+}
+
+void pico_pak_close (pico_pak* pak) {
+    if (pak->index != NULL) {
+        pico_hash_destroy(pak->index);
+    }
+    _pico_pak_unmap(pak->buf, pak->size);
+    free(pak);
+}
+
+const pico_pak_ent* pico_pak_get (pico_pak* pak, const char* name) {
+    return pico_hash_get(pak->index, name);
+}
+
+const void* pico_pak_data (pico_pak* pak, const pico_pak_ent* ent) {
+    return pak->buf + ent->off;
+}
+
+static int _pico_pak_pad (FILE* f) {
+    long n = ftell(f);
+    while (n % PICO_PAK_ALIGN != 0) {
+        if (fputc(0, f) == EOF) {
+            return 0;
+        }
+        n++;
+    }
+    return 1;
+}
+
+// Writes n entries: ents give type, size, w and h, which the contents in
+// datas follow. Returns 1 on success, or 0 otherwise.
+int pico_pak_write (const char* path, int n, const char* names[],
+                    const pico_pak_ent ents[], const void* datas[]) {
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return 0;
+    }
+
+    pico_pak_ent* idx = malloc(n * sizeof(pico_pak_ent) + 1);
+    if (idx == NULL) {
+        fclose(f);
+        return 0;
+    }
+
+    // names follow the index, blobs follow the names
+    size_t off = sizeof(pico_pak_head) + n*sizeof(pico_pak_ent);
+    for (int i=0; i<n; i++) {
+        idx[i] = ents[i];
+        idx[i].name = off;
+        off += strlen(names[i]) + 1;
+    }
+    for (int i=0; i<n; i++) {
+        off = (off + PICO_PAK_ALIGN-1) / PICO_PAK_ALIGN * PICO_PAK_ALIGN;
+        idx[i].off = off;
+        off += idx[i].size;
+    }
+
+    pico_pak_head head = { {0}, PICO_PAK_VERSION, n, 0 };
+    memcpy(head.magic, PICO_PAK_MAGIC, 4);
+    int ok = (fwrite(&head, sizeof(head), 1, f) == 1);
+    ok = ok && (n == 0 || fwrite(idx, sizeof(pico_pak_ent), n, f) == (size_t)n);
+    for (int i=0; ok && i<n; i++) {
+        ok = (fwrite(names[i], strlen(names[i])+1, 1, f) == 1);
+    }
+    for (int i=0; ok && i<n; i++) {
+        ok = _pico_pak_pad(f) && (idx[i].size == 0 || fwrite(datas[i], idx[i].size, 1, f) == 1);
+    }
+
+    free(idx);
+    return (fclose(f) == 0) && ok;
+}
@@ -0,0 +1,44 @@
+#ifndef PICO_PAK_H
+#define PICO_PAK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Archive layout (host byte order):
+//  - header: magic "PPAK", version, number of entries, padding
+//  - index:  one pico_pak_ent per entry
+//  - names:  NUL-terminated strings
+//  - blobs:  entry contents, each aligned to PICO_PAK_ALIGN
+
+#define PICO_PAK_MAGIC   "PPAK"
+#define PICO_PAK_VERSION 1
+#define PICO_PAK_ALIGN   16
+
+#define PICO_PAK_RAW  0     // file contents as is
+#define PICO_PAK_RGBA 1     // decoded image, w*h pixels in RGBA8888
+
+typedef struct pico_pak_ent {
+    uint32_t name;          // offset of the name in the archive
+    uint32_t type;
+    uint32_t off;           // offset of the contents in the archive
+    uint32_t size;
+    uint32_t w, h;          // PICO_PAK_RGBA only
+} pico_pak_ent;
+
+typedef struct pico_pak pico_pak;
+
+pico_pak* pico_pak_open (const char* path);
+void pico_pak_close (pico_pak* pak);
+const pico_pak_ent* pico_pak_get (pico_pak* pak, const char* name);
+const void* pico_pak_data (pico_pak* pak, const pico_pak_ent* ent);
+int pico_pak_write (const char* path, int n, const char* names[],
+                    const pico_pak_ent ents[], const void* datas[]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PICO_PAK_H
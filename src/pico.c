@@ -2,6 +2,17 @@
 #include <SDL2/SDL_video.h>
 #include <unistd.h>
 #include <time.h>
+#include <sys/stat.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PICO_X86
+#endif
+#ifdef _WIN32
+#include <direct.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
 
 #include <SDL2/SDL2_gfxPrimitives.h>
 #include <SDL2/SDL_image.h>
@@ -10,13 +21,131 @@
 
 #include "dir.h"
 #include "hash.h"
+#include "pak.h"
 #include "pico.h"
+#include "tiny.h"
 
 #define SDL_ANY PICO_ANY
 #define MAX(x,y) ((x) > (y) ? (x) : (y))
 
 static SDL_Window*  WIN;
 static SDL_Texture* TEX;
+static SDL_Texture* GRID;   // cached grid overlay, rebuilt on size changes
+
+// Offscreen screens composited at present in z order.
+// The first one is the main screen, whose texture is TEX.
+typedef struct {
+    char* name;
+    SDL_Texture* tex;
+    int z;
+    int show;
+    Uint8 alpha;
+    Pico_Pos scroll;
+} Pico_Layer;
+
+static struct {
+    int n;
+    Pico_Layer vec[PICO_LAYERS];
+} _pico_layers = { 1, { {NULL, NULL, 0, 1, 0xFF, {0,0}} } };
+
+// Every drawing operation is resolved into a command, with final target
+// coordinates, color and texture, which is then executed (or queued for the
+// render thread) and, while recording, appended to the current display list.
+
+typedef enum {
+    PICO_CMD_CALL, PICO_CMD_CAMERA, PICO_CMD_CLEAR, PICO_CMD_COPY,
+    PICO_CMD_GEOM, PICO_CMD_LINE, PICO_CMD_LIST, PICO_CMD_OVAL,
+    PICO_CMD_PIXEL, PICO_CMD_PIXELS, PICO_CMD_PRESENT, PICO_CMD_RECT
+} PICO_CMD;
+
+typedef struct {
+    PICO_CMD op;
+    Pico_Color color;
+    union {
+        Pico_Pos pixel;
+        struct {
+            Pico_Pos p1, p2;
+        } line;
+        struct {
+            const Pico_Pos* vec;    // or index in Pico_List.pts, if recorded
+            int i, n;
+        } pixels;
+        struct {
+            PICO_STYLE style;
+            Pico_Rect r;
+        } rect;                     // also oval
+        struct {
+            SDL_Texture* tex;       // or NULL to copy from sfc
+            SDL_Surface* sfc;
+            int own;                // tex/sfc are freed with the command
+            Pico_Rect crp;          // zero width for the whole texture
+            Pico_Rect dst;
+            float angle;
+            PICO_FLIP flip;
+        } copy;
+        struct {
+            float* xy;              // 4 corners per quad
+            SDL_Color* col;         // one per corner, in the same block
+            int n;                  // number of quads
+            int own;                // the block is freed with the command
+            Pico_Rect r;            // bounds of all quads
+        } geom;
+        struct {
+            struct Pico_List* l;
+            Pico_Pos off;
+        } list;
+        struct {
+            void (*f) (void*);
+            void* arg;
+        } call;
+        Pico_Camera camera;
+    };
+} Pico_Cmd;
+
+// Quad indexes shared by all geometry commands (render side).
+static struct {
+    int* vec;
+    int n;                  // number of quads
+} _pico_quads;
+
+// Quads already mapped by the camera, which consecutive commands append
+// to and are drawn in a single call before anything else uses the
+// renderer (render side).
+static struct {
+    int n, max;             // number of quads
+    float* xy;
+    SDL_Color* col;
+    Pico_Rect r;            // bounds of all quads
+} _pico_batch;
+
+typedef struct Pico_List {
+    char* name;
+    int n, max;
+    Pico_Cmd* cmds;
+    int pts_n, pts_max;
+    Pico_Pos* pts;
+    struct Pico_List* next;
+} Pico_List;
+
+static struct {
+    pico_hash* hash;
+    Pico_List* all;
+    Pico_List* rec;     // list being recorded, if any
+} _pico_lists;
+
+// Optional render thread (PICO_THREAD): it owns the renderer and executes
+// the commands of one frame while the caller records the next one.
+static struct {
+    int on;
+    SDL_Thread* thr;
+    SDL_threadID id;
+    SDL_mutex* mtx;
+    SDL_cond* cnd;
+    Pico_List buf[2];
+    int cur;            // buffer being recorded by the caller
+    int busy;           // thread is executing the other buffer
+    int quit;
+} _pico_thread;
 
 #define REN (SDL_GetRenderer(WIN))
 
@@ -26,6 +155,164 @@ static SDL_Texture* TEX;
 #define PHY ({Pico_Dim phy; SDL_GetWindowSize(WIN, &phy.x, &phy.y); phy;})
 
 static pico_hash* _pico_hash;
+static pico_pak*  _pico_pak;    // archive searched before the disk
+static const char* _pico_cache; // directory of decoded images, if any
+
+// Directories of cached assets watched for changes, which are reloaded at
+// the next present. An event's descriptor selects the files of its
+// directory, which are matched by name, so that every spelling of a
+// directory reloads its cached paths.
+#define PICO_WATCH_IMAGE 1
+#define PICO_WATCH_SOUND 2
+static struct {
+    int fd;                 // inotify instance, -1 when off
+    int n;
+    struct {
+        int wd;
+        int head;           // first of its files, or -1
+    } dirs[PICO_WATCH];
+    int m, max;
+    struct {
+        int next;           // next file in the same directory, or -1
+        int kind;           // PICO_WATCH_IMAGE/SOUND
+        char* path;         // as cached
+        const char* name;   // in path, after the directory
+    }* files;
+} _pico_watch = { -1, 0, { {0, -1} }, 0, 0, NULL };
+static Pico_Stats _pico_stats;
+
+// Input session log (PICO_INPUT_RECORD/PICO_INPUT_REPLAY): user input
+// handled by pico, with its time since initialization in microseconds.
+// Mouse motions are merged up to the next other input or present, so each
+// frame logs at most one between other inputs.
+// Other events, e.g. window and music, come from SDL in both modes.
+#define PICO_LOG_MAGIC   "PLOG"
+#define PICO_LOG_VERSION 1
+static struct {
+    FILE* rec;
+    FILE* rep;
+    int fast;           // replays without waiting, in virtual time
+    Uint64 t0;          // performance counter at initialization
+    Uint32 ticks0;      // SDL ticks at initialization
+    Uint64 virt;        // virtual performance counter, when fast
+    Uint64 skew;        // virtual minus real counter, once a fast log ends
+    struct {
+        int has;
+        Uint64 at;      // performance counter to deliver it
+        Pico_Event evt;
+    } nxt;
+    struct {
+        int has;
+        Uint64 us;
+        Pico_Event evt;
+    } mot;              // merged motion, not yet written
+} _pico_log;
+
+// Region of TEX touched since the last present, in logical coordinates.
+// Under software rendering, present recomposes and updates only this region.
+static struct {
+    int soft;
+    int all;
+    Pico_Rect rect;
+} _pico_dirty = { 0, 1, {0,0,0,0} };
+
+// Bump allocator for data that lives until the next present.
+// Requests beyond its size fall back to malloc until the reset, which then
+// grows the arena to the peak use of the frame.
+typedef struct {
+    char* buf;
+    size_t max;         // size of buf
+    size_t n;           // bytes used in buf
+    size_t used;        // bytes used in the frame, including overflow
+    size_t peak;
+    void* over;         // overflow blocks, linked by their first word
+} Pico_Arena;
+
+static struct {
+    Pico_Arena app;     // caller side, also for pico_frame_alloc
+    Pico_Arena ren;     // render side
+} _pico_frame;
+
+#define PICO_ALIGN 16
+
+// Fonts opened so far, by file and height (NULL file for the default one),
+// most recently used first. Each one holds its own SDL_ttf glyph cache, so
+// bounding the list also bounds glyph memory.
+typedef struct Pico_Font {
+    char* file;
+    int h;
+    TTF_Font* ttf;
+    struct Pico_Font* next;
+} Pico_Font;
+
+static struct {
+    int n;
+    Pico_Font* all;
+} _pico_fonts;
+
+// The audio device opens on first use.
+static struct {
+    int on;
+    int freq;
+    int buf;            // sample frames per device callback
+} _pico_audio;
+
+// Streamed music: the next one waits for the current one to fade out.
+static struct {
+    Mix_Music* cur;
+    Mix_Music* next;
+    int loops;
+    int fade;
+    Uint32 evt;         // posted when the music stops
+} _pico_music;
+
+// Keyboard and mouse sampled by pico_input_poll, with the previous sample
+// kept for edges. Keys are a bitset by scancode.
+static struct {
+    struct {
+        Uint32 now[SDL_NUM_SCANCODES/32];
+        Uint32 old[SDL_NUM_SCANCODES/32];
+    } keys;
+    struct {
+        Uint32 now;
+        Uint32 old;
+    } buttons;
+    Pico_Pos mouse;
+    SDL_Scancode ascii[128];    // depends on the layout, filled on use
+} _pico_input;
+
+// Draw color and blend mode last set in the renderer (render side), so that
+// commands only set them when they change.
+static struct {
+    int ok;
+    Pico_Color color;
+    SDL_BlendMode blend;
+} _pico_ren;
+
+// Camera as set by the caller, and as applied on the render side, where
+// its matrix maps the final target coordinates of every command.
+static Pico_Camera _pico_camera = { 0, 0, 1, 0 };
+static struct {
+    int on;                 // off for PICO_CAMERA_NONE, which draws as usual
+    Pico_Camera cam;
+    float m[6];             // x' = m[0]*x + m[1]*y + m[2], y' likewise
+} _pico_cam = { 0, { 0, 0, 1, 0 }, { 1, 0, 0, 0, 1, 0 } };
+
+static void _pico_grid_destroy (void);
+static void _pico_list_exec (Pico_List* l, Pico_Pos off);
+static void _pico_list_push (Pico_List* l, Pico_Cmd c);
+static void _pico_list_reset (Pico_List* l);
+static void _pico_lists_destroy (void);
+static void _pico_output_present (int force);
+static void _pico_batch_flush (void);
+static void _pico_present (void);
+static void _pico_music_done (void);
+static void _pico_music_next (void);
+static void _pico_watch_add (const char* path, int kind);
+static FILE* _pico_log_open (const char* path, const char* mode);
+static void _pico_log_read (void);
+static void _pico_log_flush (void);
+static void _pico_watch_poll (void);
 
 static struct {
     Pico_Anchor anchor;
@@ -49,13 +336,17 @@ static struct {
     } image;
     Pico_Pos scroll;
     struct {
-        Pico_Dim org;
-        Pico_Dim cur;
+        Pico_Dim org;   // logical size, also the size of TEX
+        Pico_Dim cur;   // visible part of TEX, after zoom
     } size;
     PICO_STYLE style;
     PICO_FLIP flip;
     float angle;
-    Pico_Dim zoom;
+    struct {
+        Pico_Dim zoom;
+        Pico_Pos pan;
+    } view;
+    int layer;
 } S = {
     { PICO_CENTER, PICO_MIDDLE },
     { {0x00,0x00,0x00,0xFF}, {0xFF,0xFF,0xFF,0xFF} },
@@ -69,7 +360,8 @@ static struct {
     PICO_FILL,
     PICO_NOFLIP,
     0.0f,
-    {100, 100}
+    { {100, 100}, {0, 0} },
+    0
 };
 
 static int hanchor (int x, int w) {
@@ -80,6 +372,279 @@ static int vanchor (int y, int h) {
     return y - (S.anchor.y*h)/100;
 }
 
+static void _pico_dirty_add (Pico_Rect r) {
+    if (_pico_dirty.all || r.w<=0 || r.h<=0) {
+        return;
+    }
+    Pico_Pos scroll = _pico_layers.vec[S.layer].scroll;
+    r.x -= scroll.x;
+    r.y -= scroll.y;
+    if (SDL_RectEmpty(&_pico_dirty.rect)) {
+        _pico_dirty.rect = r;
+    } else {
+        SDL_UnionRect(&_pico_dirty.rect, &r, &_pico_dirty.rect);
+    }
+}
+
+// rotated copies may cover the whole circle around the rect
+static void _pico_dirty_add_rotated (Pico_Rect r, float angle) {
+    if (angle != 0) {
+        int d = SDL_ceilf(SDL_sqrtf(r.w*r.w + r.h*r.h));
+        r = (Pico_Rect) { r.x+r.w/2-d/2-1, r.y+r.h/2-d/2-1, d+2, d+2 };
+    }
+    _pico_dirty_add(r);
+}
+
+static void _pico_dirty_all (void) {
+    _pico_dirty.all = 1;
+}
+
+// Part of TEX shown in the window: zoom centers it, Ctrl+arrows pan it.
+static Pico_Rect _pico_view (void) {
+    return (Pico_Rect) {
+        (S.size.org.x - S.size.cur.x)/2 + S.view.pan.x,
+        (S.size.org.y - S.size.cur.y)/2 + S.view.pan.y,
+        S.size.cur.x, S.size.cur.y
+    };
+}
+
+// ARENA
+
+static void _pico_arena_init (Pico_Arena* a) {
+    *a = (Pico_Arena) { malloc(PICO_FRAME), PICO_FRAME, 0, 0, 0, NULL };
+    assert(a->buf != NULL && "cannot allocate frame memory");
+}
+
+static void* _pico_arena_alloc (Pico_Arena* a, size_t size) {
+    size = (size + PICO_ALIGN-1) & ~(size_t)(PICO_ALIGN-1);
+    a->used += size;
+    a->peak = MAX(a->peak, a->used);
+    if (a->n+size <= a->max) {
+        void* p = a->buf + a->n;
+        a->n += size;
+        return p;
+    }
+    void** blk = malloc(PICO_ALIGN + size);
+    assert(blk != NULL && "cannot allocate frame memory");
+    *blk = a->over;
+    a->over = blk;
+    return (char*)blk + PICO_ALIGN;
+}
+
+static void _pico_arena_reset (Pico_Arena* a) {
+    while (a->over != NULL) {
+        void** blk = a->over;
+        a->over = *blk;
+        free(blk);
+    }
+    if (a->used > a->max) {
+        free(a->buf);
+        a->max = a->used;
+        a->buf = malloc(a->max);
+        assert(a->buf != NULL && "cannot allocate frame memory");
+    }
+    a->n = 0;
+    a->used = 0;
+}
+
+static void _pico_arena_free (Pico_Arena* a) {
+    _pico_arena_reset(a);
+    free(a->buf);
+    *a = (Pico_Arena) { NULL, 0, 0, 0, 0, NULL };
+}
+
+// ARCHIVE
+
+static const pico_pak_ent* _pico_pak_get (const char* path) {
+    return (_pico_pak == NULL) ? NULL : pico_pak_get(_pico_pak, path);
+}
+
+static SDL_RWops* _pico_pak_rw (const pico_pak_ent* e) {
+    assert(e->type == PICO_PAK_RAW && "archive entry is a decoded image");
+    return SDL_RWFromConstMem(pico_pak_data(_pico_pak, e), e->size);
+}
+
+// THREAD
+
+// Whether the caller may use the renderer directly.
+static int _pico_render_side (void) {
+    return !_pico_thread.on || SDL_ThreadID()==_pico_thread.id;
+}
+
+static int _pico_thread_loop (void* arg) {
+    SDL_LockMutex(_pico_thread.mtx);
+    while (1) {
+        while (!_pico_thread.busy && !_pico_thread.quit) {
+            SDL_CondWait(_pico_thread.cnd, _pico_thread.mtx);
+        }
+        if (!_pico_thread.busy) {
+            break;
+        }
+        Pico_List* l = &_pico_thread.buf[!_pico_thread.cur];
+        SDL_UnlockMutex(_pico_thread.mtx);
+        _pico_list_exec(l, (Pico_Pos){0,0});
+        _pico_list_reset(l);
+        SDL_LockMutex(_pico_thread.mtx);
+        _pico_thread.busy = 0;
+        SDL_CondBroadcast(_pico_thread.cnd);
+    }
+    SDL_UnlockMutex(_pico_thread.mtx);
+    return 0;
+}
+
+// Hands the recorded buffer to the render thread, once it is done with the
+// previous one, and optionally waits until it is executed.
+static void _pico_thread_flush (int wait) {
+    SDL_LockMutex(_pico_thread.mtx);
+    while (_pico_thread.busy) {
+        SDL_CondWait(_pico_thread.cnd, _pico_thread.mtx);
+    }
+    _pico_thread.cur = !_pico_thread.cur;
+    _pico_thread.busy = 1;
+    SDL_CondBroadcast(_pico_thread.cnd);
+    while (wait && _pico_thread.busy) {
+        SDL_CondWait(_pico_thread.cnd, _pico_thread.mtx);
+    }
+    SDL_UnlockMutex(_pico_thread.mtx);
+}
+
+// Waits for all queued commands, so that the caller may change state
+// that the render thread reads.
+static void _pico_sync (void) {
+    if (!_pico_render_side()) {
+        _pico_thread_flush(1);
+    }
+}
+
+// Runs f on the render side and waits for it.
+static void _pico_call (void (*f) (void*), void* arg) {
+    if (_pico_render_side()) {
+        _pico_batch_flush();
+        f(arg);
+    } else {
+        _pico_list_push (
+            &_pico_thread.buf[_pico_thread.cur],
+            (Pico_Cmd) { .op=PICO_CMD_CALL, .call={f,arg} }
+        );
+        _pico_thread_flush(1);
+    }
+}
+
+// RENDERER STATE
+
+static void _pico_color (Pico_Color c) {
+    if (_pico_ren.ok && memcmp(&c, &_pico_ren.color, sizeof(Pico_Color))==0) {
+        _pico_stats.state.avoided++;
+        return;
+    }
+    SDL_SetRenderDrawColor(REN, c.r, c.g, c.b, c.a);
+    _pico_ren.color = c;
+    _pico_stats.state.calls++;
+}
+
+static void _pico_blend (SDL_BlendMode mode) {
+    if (_pico_ren.ok && mode==_pico_ren.blend) {
+        _pico_stats.state.avoided++;
+        return;
+    }
+    SDL_SetRenderDrawBlendMode(REN, mode);
+    _pico_ren.blend = mode;
+    _pico_stats.state.calls++;
+}
+
+// Tracking (re)starts here, once both values are known, e.g. after
+// SDL2_gfx changes them on its own.
+static void _pico_color_blend (Pico_Color c, SDL_BlendMode mode) {
+    if (_pico_ren.ok) {
+        _pico_color(c);
+        _pico_blend(mode);
+        return;
+    }
+    SDL_SetRenderDrawColor(REN, c.r, c.g, c.b, c.a);
+    SDL_SetRenderDrawBlendMode(REN, mode);
+    _pico_ren.ok = 1;
+    _pico_ren.color = c;
+    _pico_ren.blend = mode;
+    _pico_stats.state.calls += 2;
+}
+
+static SDL_Texture* _pico_layer_tex (void) {
+    SDL_Texture* tex = SDL_CreateTexture (
+        REN, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        S.size.org.x, S.size.org.y
+    );
+    pico_assert(tex != NULL);
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderTarget(REN, tex);
+    _pico_color((Pico_Color) {0x00,0x00,0x00,0x00});
+    SDL_RenderClear(REN);
+    return tex;
+}
+
+static void _pico_layer_new (void* name) {
+    int i = _pico_layers.n++;
+    _pico_layers.vec[i] = (Pico_Layer) {
+        strdup(name), _pico_layer_tex(), 0, 1, 0xFF, {0,0}
+    };
+    SDL_SetRenderTarget(REN, _pico_layers.vec[S.layer].tex);
+}
+
+// Finds a layer by name, creating it on first use (NULL is the main screen).
+static int _pico_layer (const char* name) {
+    if (name == NULL) {
+        return 0;
+    }
+    for (int i=1; i<_pico_layers.n; i++) {
+        if (strcmp(_pico_layers.vec[i].name, name) == 0) {
+            return i;
+        }
+    }
+    assert(_pico_layers.n < PICO_LAYERS && "too many layers");
+    _pico_call(_pico_layer_new, (void*)name);
+    return _pico_layers.n - 1;
+}
+
+// CAMERA
+
+static int _pico_camera_none (Pico_Camera cam) {
+    return cam.x==0 && cam.y==0 && cam.zoom==1 && cam.angle==0;
+}
+
+// Pans, then zooms and rotates around the center of the logical screen.
+static void _pico_camera_matrix (Pico_Camera cam, float m[6]) {
+    float a  = cam.angle * M_PI / 180;
+    float co = cam.zoom * SDL_cosf(a);
+    float si = cam.zoom * SDL_sinf(a);
+    float cx = S.size.org.x / 2.0f;
+    float cy = S.size.org.y / 2.0f;
+    float px = -cam.x - cx;
+    float py = -cam.y - cy;
+    m[0] = co;  m[1] = -si; m[2] = cx + co*px - si*py;
+    m[3] = si;  m[4] = co;  m[5] = cy + si*px + co*py;
+}
+
+// Maps a logical position back to the coordinates that drew it.
+static Pico_Pos _pico_camera_unmap (Pico_Pos p) {
+    if (_pico_camera_none(_pico_camera)) {
+        return p;
+    }
+    float m[6];
+    _pico_camera_matrix(_pico_camera, m);
+    float x = p.x + 0.5f - m[2];
+    float y = p.y + 0.5f - m[5];
+    float d = m[0]*m[4] - m[1]*m[3];
+    return (Pico_Pos) {
+        SDL_floorf((m[4]*x - m[1]*y) / d),
+        SDL_floorf((m[0]*y - m[3]*x) / d),
+    };
+}
+
+static void _pico_cam_set (Pico_Camera cam) {
+    _pico_cam.on  = !_pico_camera_none(cam);
+    _pico_cam.cam = cam;
+    _pico_camera_matrix(cam, _pico_cam.m);
+}
+
 // UTILS
 
 Pico_Dim pico_dim (int x, int y) {
@@ -91,6 +656,10 @@ Pico_Dim pico_dim_ext (Pico_Dim d, int x, int y) {
     return (Pico_Dim){ (x*d.x)/100, (y*d.y)/100};
 }
 
+void* pico_frame_alloc (size_t size) {
+    return _pico_arena_alloc(&_pico_frame.app, size);
+}
+
 int pico_pos_vs_rect (Pico_Pos pt, Pico_Rect r) {
     r.x = hanchor(r.x, r.w);
     r.y = vanchor(r.y, r.h);
@@ -133,14 +702,245 @@ int pico_rect_vs_rect_ext (Pico_Rect r1, Pico_Anchor a1, Pico_Rect r2, Pico_Anch
     return SDL_HasIntersection(&r1, &r2);
 }
 
+// HIT TESTS
+
+// Batch tests of a rectangle q, already anchored, against rectangles in
+// either layout, anchored by a. A point is a 1x1 rectangle.
+// The vectorized anchor computes a*w/100 in float, which is exact while
+// a*w fits in 24 bits.
+
+static Pico_Rect _pico_hit_rect (const Pico_Rect* aos, const Pico_Rects* soa, int i) {
+    return (aos != NULL) ? aos[i] : (Pico_Rect) { soa->x[i], soa->y[i], soa->w[i], soa->h[i] };
+}
+
+static int _pico_hit_c (Pico_Rect q, Pico_Anchor a, const Pico_Rect* aos,
+                        const Pico_Rects* soa, int i, int n, int ids[], int k) {
+    for (; i<n; i++) {
+        Pico_Rect r = _pico_hit_rect(aos, soa, i);
+        r.x -= (a.x*r.w)/100;
+        r.y -= (a.y*r.h)/100;
+        if (r.w>0 && r.h>0 && q.x<r.x+r.w && r.x<q.x+q.w && q.y<r.y+r.h && r.y<q.y+q.h) {
+            ids[k++] = i;
+        }
+    }
+    return k;
+}
+
+static int _pico_hit_scalar (Pico_Rect q, Pico_Anchor a, const Pico_Rect* aos,
+                             const Pico_Rects* soa, int n, int ids[]) {
+    return _pico_hit_c(q, a, aos, soa, 0, n, ids, 0);
+}
+
+#ifdef PICO_X86
+__attribute__((target("sse2")))
+static int _pico_hit_sse2 (Pico_Rect q, Pico_Anchor a, const Pico_Rect* aos,
+                           const Pico_Rects* soa, int n, int ids[]) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i qx = _mm_set1_epi32(q.x), qr = _mm_set1_epi32(q.x+q.w);
+    const __m128i qy = _mm_set1_epi32(q.y), qb = _mm_set1_epi32(q.y+q.h);
+    const __m128  ax = _mm_set1_ps(a.x), ay = _mm_set1_ps(a.y), c = _mm_set1_ps(100);
+    int i=0, k=0;
+    for (; i+4<=n; i+=4) {
+        __m128i x, y, w, h;
+        if (aos != NULL) {
+            // 4 rectangles transposed to 4 fields
+            __m128i r0 = _mm_loadu_si128((const __m128i*)&aos[i+0]);
+            __m128i r1 = _mm_loadu_si128((const __m128i*)&aos[i+1]);
+            __m128i r2 = _mm_loadu_si128((const __m128i*)&aos[i+2]);
+            __m128i r3 = _mm_loadu_si128((const __m128i*)&aos[i+3]);
+            __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+            __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+            __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+            __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+            x = _mm_unpacklo_epi64(t0, t1);
+            y = _mm_unpackhi_epi64(t0, t1);
+            w = _mm_unpacklo_epi64(t2, t3);
+            h = _mm_unpackhi_epi64(t2, t3);
+        } else {
+            x = _mm_loadu_si128((const __m128i*)&soa->x[i]);
+            y = _mm_loadu_si128((const __m128i*)&soa->y[i]);
+            w = _mm_loadu_si128((const __m128i*)&soa->w[i]);
+            h = _mm_loadu_si128((const __m128i*)&soa->h[i]);
+        }
+        x = _mm_sub_epi32(x, _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(w),ax), c)));
+        y = _mm_sub_epi32(y, _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(h),ay), c)));
+        __m128i m = _mm_and_si128(_mm_cmpgt_epi32(w,zero), _mm_cmpgt_epi32(h,zero));
+        m = _mm_and_si128(m, _mm_cmplt_epi32(qx, _mm_add_epi32(x,w)));
+        m = _mm_and_si128(m, _mm_cmplt_epi32(x, qr));
+        m = _mm_and_si128(m, _mm_cmplt_epi32(qy, _mm_add_epi32(y,h)));
+        m = _mm_and_si128(m, _mm_cmplt_epi32(y, qb));
+        for (int bits=_mm_movemask_ps(_mm_castsi128_ps(m)); bits!=0; bits&=bits-1) {
+            ids[k++] = i + __builtin_ctz(bits);
+        }
+    }
+    return _pico_hit_c(q, a, aos, soa, i, n, ids, k);
+}
+
+__attribute__((target("avx2")))
+static int _pico_hit_avx2 (Pico_Rect q, Pico_Anchor a, const Pico_Rect* aos,
+                           const Pico_Rects* soa, int n, int ids[]) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i qx = _mm256_set1_epi32(q.x), qr = _mm256_set1_epi32(q.x+q.w);
+    const __m256i qy = _mm256_set1_epi32(q.y), qb = _mm256_set1_epi32(q.y+q.h);
+    const __m256  ax = _mm256_set1_ps(a.x), ay = _mm256_set1_ps(a.y), c = _mm256_set1_ps(100);
+    // transposed rectangles come in order 0,2,4,6,1,3,5,7
+    const __m256i ord = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i=0, k=0;
+    for (; i+8<=n; i+=8) {
+        __m256i x, y, w, h;
+        if (aos != NULL) {
+            __m256i v0 = _mm256_loadu_si256((const __m256i*)&aos[i+0]);
+            __m256i v1 = _mm256_loadu_si256((const __m256i*)&aos[i+2]);
+            __m256i v2 = _mm256_loadu_si256((const __m256i*)&aos[i+4]);
+            __m256i v3 = _mm256_loadu_si256((const __m256i*)&aos[i+6]);
+            __m256i t0 = _mm256_unpacklo_epi32(v0, v1);
+            __m256i t1 = _mm256_unpacklo_epi32(v2, v3);
+            __m256i t2 = _mm256_unpackhi_epi32(v0, v1);
+            __m256i t3 = _mm256_unpackhi_epi32(v2, v3);
+            x = _mm256_unpacklo_epi64(t0, t1);
+            y = _mm256_unpackhi_epi64(t0, t1);
+            w = _mm256_unpacklo_epi64(t2, t3);
+            h = _mm256_unpackhi_epi64(t2, t3);
+        } else {
+            x = _mm256_loadu_si256((const __m256i*)&soa->x[i]);
+            y = _mm256_loadu_si256((const __m256i*)&soa->y[i]);
+            w = _mm256_loadu_si256((const __m256i*)&soa->w[i]);
+            h = _mm256_loadu_si256((const __m256i*)&soa->h[i]);
+        }
+        x = _mm256_sub_epi32(x, _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(w),ax), c)));
+        y = _mm256_sub_epi32(y, _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(h),ay), c)));
+        __m256i m = _mm256_and_si256(_mm256_cmpgt_epi32(w,zero), _mm256_cmpgt_epi32(h,zero));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(_mm256_add_epi32(x,w), qx));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(qr, x));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(_mm256_add_epi32(y,h), qy));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(qb, y));
+        if (aos != NULL) {
+            m = _mm256_permutevar8x32_epi32(m, ord);
+        }
+        for (int bits=_mm256_movemask_ps(_mm256_castsi256_ps(m)); bits!=0; bits&=bits-1) {
+            ids[k++] = i + __builtin_ctz(bits);
+        }
+    }
+    return _pico_hit_c(q, a, aos, soa, i, n, ids, k);
+}
+#endif
+
+// Picks the widest instruction set on first use.
+static int _pico_hit (Pico_Rect q, const Pico_Rect* aos, const Pico_Rects* soa, int n, int ids[]) {
+    if (q.w<=0 || q.h<=0) {
+        return 0;
+    }
+    static int (*f) (Pico_Rect, Pico_Anchor, const Pico_Rect*, const Pico_Rects*, int, int[]);
+    if (f == NULL) {
+        f = _pico_hit_scalar;
+#ifdef PICO_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            f = _pico_hit_avx2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            f = _pico_hit_sse2;
+        }
+#endif
+    }
+    return f(q, S.anchor, aos, soa, n, ids);
+}
+
+int pico_pos_vs_rects (Pico_Pos pt, const Pico_Rect rs[], int n, int ids[]) {
+    return _pico_hit((Pico_Rect) { hanchor(pt.x,1), vanchor(pt.y,1), 1, 1 }, rs, NULL, n, ids);
+}
+
+int pico_pos_vs_rects_soa (Pico_Pos pt, Pico_Rects rs, int n, int ids[]) {
+    return _pico_hit((Pico_Rect) { hanchor(pt.x,1), vanchor(pt.y,1), 1, 1 }, NULL, &rs, n, ids);
+}
+
+int pico_rect_vs_rects (Pico_Rect r, const Pico_Rect rs[], int n, int ids[]) {
+    r.x = hanchor(r.x, r.w);
+    r.y = vanchor(r.y, r.h);
+    return _pico_hit(r, rs, NULL, n, ids);
+}
+
+int pico_rect_vs_rects_soa (Pico_Rect r, Pico_Rects rs, int n, int ids[]) {
+    r.x = hanchor(r.x, r.w);
+    r.y = vanchor(r.y, r.h);
+    return _pico_hit(r, NULL, &rs, n, ids);
+}
+
 // INIT
 
+static Uint32 _pico_usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+static void _pico_audio_open (void) {
+    if (_pico_audio.on) {
+        return;
+    }
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    const char* freq = SDL_getenv("PICO_AUDIO_FREQ");
+    const char* buf  = SDL_getenv("PICO_AUDIO_BUFFER");
+    _pico_audio.freq = (freq == NULL) ? 44100 : SDL_atoi(freq);
+    _pico_audio.buf  = (buf  == NULL) ? 1024  : SDL_atoi(buf);
+    assert(_pico_audio.freq>0 && _pico_audio.buf>0 && "invalid audio configuration");
+    pico_assert(0 == Mix_OpenAudio(_pico_audio.freq, AUDIO_S16SYS, 2, _pico_audio.buf));
+    Mix_QuerySpec(&_pico_audio.freq, NULL, NULL);
+    Mix_AllocateChannels(PICO_CHANNELS);
+    if (_pico_music.evt == 0) {
+        _pico_music.evt = SDL_RegisterEvents(1);
+    }
+    Mix_HookMusicFinished(_pico_music_done);
+    _pico_audio.on = 1;
+    _pico_stats.init.audio = _pico_usecs(t0);
+}
+
+// Opens the default font on first use of text.
+static void _pico_font (void) {
+    if (S.font.ttf == NULL) {
+        pico_set_font(NULL, 0);
+    }
+}
+
+static void _pico_ren_open (void* arg) {
+    if (SDL_CreateRenderer(WIN, -1, SDL_RENDERER_ACCELERATED) == NULL) {
+        SDL_CreateRenderer(WIN, -1, SDL_RENDERER_SOFTWARE);
+    }
+    pico_assert(REN != NULL);
+    {
+        SDL_RendererInfo info;
+        pico_assert(0 == SDL_GetRendererInfo(REN, &info));
+        _pico_dirty.soft = (info.flags & SDL_RENDERER_SOFTWARE) != 0;
+    }
+    _pico_ren.ok = 0;
+    _pico_color_blend((Pico_Color) {0xFF,0xFF,0xFF,0xFF}, SDL_BLENDMODE_BLEND);
+}
+
+static void _pico_ren_close (void* arg) {
+    _pico_grid_destroy();
+    for (int i=1; i<_pico_layers.n; i++) {
+        free(_pico_layers.vec[i].name);
+        SDL_DestroyTexture(_pico_layers.vec[i].tex);
+    }
+    _pico_layers.n = 1;
+    S.layer = 0;
+    _pico_lists_destroy();
+    free(_pico_quads.vec);
+    _pico_quads.vec = NULL;
+    _pico_quads.n = 0;
+    free(_pico_batch.xy);
+    free(_pico_batch.col);
+    memset(&_pico_batch, 0, sizeof(_pico_batch));
+    SDL_DestroyRenderer(REN);
+}
+
 void pico_init (int on) {
     char* dir = pico_dir_exe_get();
     assert(dir!=NULL && "cannot determine execution path");
     assert(chdir(dir)==0 && "cannot determine execution path");
     if (on) {
         _pico_hash = pico_hash_create(PICO_HASH);
+        _pico_lists.hash = pico_hash_create(PICO_HASH);
+        _pico_arena_init(&_pico_frame.app);
+        _pico_arena_init(&_pico_frame.ren);
+        Uint64 t0 = SDL_GetPerformanceCounter();
         pico_assert(0 == SDL_Init(SDL_INIT_VIDEO));
         WIN = SDL_CreateWindow (
             PICO_TITLE, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
@@ -148,23 +948,121 @@ void pico_init (int on) {
         );
         pico_assert(WIN != NULL);
 
-        SDL_CreateRenderer(WIN, -1, SDL_RENDERER_ACCELERATED);
-        //SDL_CreateRenderer(WIN, -1, SDL_RENDERER_SOFTWARE);
-        pico_assert(REN != NULL);
-        SDL_SetRenderDrawBlendMode(REN, SDL_BLENDMODE_BLEND);
+        // the window stays with the caller, the renderer goes to the thread
+        const char* thr = SDL_getenv("PICO_THREAD");
+        _pico_thread.on = (thr!=NULL && strcmp(thr,"0")!=0);
+        if (_pico_thread.on) {
+            _pico_thread.mtx = SDL_CreateMutex();
+            _pico_thread.cnd = SDL_CreateCond();
+            pico_assert(_pico_thread.mtx!=NULL && _pico_thread.cnd!=NULL);
+            _pico_thread.thr = SDL_CreateThread(_pico_thread_loop, "pico-render", NULL);
+            pico_assert(_pico_thread.thr != NULL);
+            _pico_thread.id = SDL_GetThreadID(_pico_thread.thr);
+        }
+        _pico_call(_pico_ren_open, NULL);
+
+        // changed assets are reloaded during content iteration
+#ifdef __linux__
+        const char* wat = SDL_getenv("PICO_WATCH");
+        if (wat!=NULL && strcmp(wat,"0")!=0) {
+            _pico_watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            pico_assert(_pico_watch.fd >= 0);
+        }
+#endif
+
+        // input sessions are recorded and replayed from init on
+        const char* rec = SDL_getenv("PICO_INPUT_RECORD");
+        const char* rep = SDL_getenv("PICO_INPUT_REPLAY");
+        const char* fst = SDL_getenv("PICO_INPUT_FAST");
+        _pico_log.t0 = _pico_log.virt = SDL_GetPerformanceCounter();
+        _pico_log.ticks0 = SDL_GetTicks();
+        _pico_log.fast = (rep!=NULL && fst!=NULL && strcmp(fst,"0")!=0);
+        _pico_log.skew = 0;
+        if (rec != NULL) {
+            _pico_log.rec = _pico_log_open(rec, "wb");
+        }
+        if (rep != NULL) {
+            _pico_log.rep = _pico_log_open(rep, "rb");
+            _pico_log_read();
+        }
 
-        TTF_Init();
-        Mix_OpenAudio(22050, AUDIO_S16SYS, 2, 4096);
+        // decoded images are kept on disk across runs
+        _pico_cache = SDL_getenv("PICO_IMAGE_CACHE");
+        if (_pico_cache != NULL) {
+#ifdef _WIN32
+            _mkdir(_pico_cache);
+#else
+            mkdir(_pico_cache, 0755);
+#endif
+        }
 
+        // fonts and audio are only opened when first used
         pico_set_size(PICO_DIM_PHY, PICO_DIM_LOG);
-        pico_set_font(NULL, 0);
+        _pico_stats.init.video = _pico_usecs(t0);
     } else {
-        if (S.font.ttf != NULL) {
-            TTF_CloseFont(S.font.ttf);
+        while (_pico_fonts.all != NULL) {
+            Pico_Font* f = _pico_fonts.all;
+            _pico_fonts.all = f->next;
+            TTF_CloseFont(f->ttf);
+            free(f->file);
+            free(f);
+        }
+        _pico_fonts.n = 0;
+        S.font.ttf = NULL;
+        _pico_call(_pico_ren_close, NULL);
+        if (_pico_thread.on) {
+            SDL_LockMutex(_pico_thread.mtx);
+            _pico_thread.quit = 1;
+            SDL_CondBroadcast(_pico_thread.cnd);
+            SDL_UnlockMutex(_pico_thread.mtx);
+            SDL_WaitThread(_pico_thread.thr, NULL);
+            SDL_DestroyCond(_pico_thread.cnd);
+            SDL_DestroyMutex(_pico_thread.mtx);
+            for (int i=0; i<2; i++) {
+                free(_pico_thread.buf[i].cmds);
+                free(_pico_thread.buf[i].pts);
+            }
+            memset(&_pico_thread, 0, sizeof(_pico_thread));
+        }
+        _pico_arena_free(&_pico_frame.app);
+        _pico_arena_free(&_pico_frame.ren);
+        _pico_camera = PICO_CAMERA_NONE;
+        _pico_cam_set(PICO_CAMERA_NONE);
+        if (_pico_audio.on) {
+            Mix_HookMusicFinished(NULL);
+            Mix_HaltMusic();
+            Mix_FreeMusic(_pico_music.cur);
+            Mix_FreeMusic(_pico_music.next);
+            _pico_music.cur = _pico_music.next = NULL;
+            Mix_CloseAudio();
+            _pico_audio.on = 0;
+        }
+        if (TTF_WasInit()) {
+            TTF_Quit();
+        }
+        if (_pico_pak != NULL) {
+            pico_pak_close(_pico_pak);
+            _pico_pak = NULL;
+        }
+        if (_pico_log.rec != NULL) {
+            _pico_log_flush();
+            fclose(_pico_log.rec);
+            _pico_log.rec = NULL;
+        }
+        if (_pico_log.rep != NULL) {
+            fclose(_pico_log.rep);
+            _pico_log.rep = NULL;
+        }
+        if (_pico_watch.fd >= 0) {
+            close(_pico_watch.fd);
+            _pico_watch.fd = -1;
+            for (int i=0; i<_pico_watch.m; i++) {
+                free(_pico_watch.files[i].path);
+            }
+            free(_pico_watch.files);
+            _pico_watch.files = NULL;
+            _pico_watch.n = _pico_watch.m = _pico_watch.max = 0;
         }
-        Mix_CloseAudio();
-        TTF_Quit();
-        SDL_DestroyRenderer(REN);
         SDL_DestroyWindow(WIN);
         SDL_Quit();
         pico_hash_destroy(_pico_hash);
@@ -173,17 +1071,93 @@ void pico_init (int on) {
 
 // INPUT
 
+// Performance counter, or the virtual one of a fast replay, which goes on
+// from where the log ended.
+static Uint64 _pico_now (void) {
+    if (!_pico_log.fast) {
+        return SDL_GetPerformanceCounter();
+    } else if (_pico_log.rep != NULL) {
+        return _pico_log.virt;
+    } else {
+        return SDL_GetPerformanceCounter() + _pico_log.skew;
+    }
+}
+
+static int _pico_log_input (Uint32 type) {
+    return type==SDL_QUIT || (SDL_KEYDOWN<=type && type<=SDL_MOUSEWHEEL);
+}
+
+static void _pico_log_put (Uint64 us, const Pico_Event* e) {
+    fwrite(&us, sizeof(us), 1, _pico_log.rec);
+    fwrite(e, sizeof(*e), 1, _pico_log.rec);
+}
+
+static void _pico_log_flush (void) {
+    if (_pico_log.rec!=NULL && _pico_log.mot.has) {
+        _pico_log_put(_pico_log.mot.us, &_pico_log.mot.evt);
+        _pico_log.mot.has = 0;
+    }
+}
+
+// Keeps the last motion, at its own time, with the relative motions summed.
+static void _pico_log_write (const Pico_Event* e) {
+    Uint64 us = (_pico_now() - _pico_log.t0) * 1000000 / SDL_GetPerformanceFrequency();
+    if (e->type == SDL_MOUSEMOTION) {
+        Pico_Event m = *e;
+        if (_pico_log.mot.has) {
+            m.motion.xrel += _pico_log.mot.evt.motion.xrel;
+            m.motion.yrel += _pico_log.mot.evt.motion.yrel;
+        }
+        _pico_log.mot.has = 1;
+        _pico_log.mot.us  = us;
+        _pico_log.mot.evt = m;
+        return;
+    }
+    _pico_log_flush();
+    _pico_log_put(us, e);
+}
+
+static void _pico_log_read (void) {
+    Uint64 us;
+    _pico_log.nxt.has =
+        fread(&us, sizeof(us), 1, _pico_log.rep) == 1 &&
+        fread(&_pico_log.nxt.evt, sizeof(Pico_Event), 1, _pico_log.rep) == 1;
+    _pico_log.nxt.at = _pico_log.t0 + us*SDL_GetPerformanceFrequency()/1000000;
+}
+
+static FILE* _pico_log_open (const char* path, const char* mode) {
+    FILE* f = fopen(path, mode);
+    pico_assert(f != NULL);
+    struct { char magic[4]; Uint32 version; } hdr = { {0}, PICO_LOG_VERSION };
+    if (mode[0] == 'w') {
+        memcpy(hdr.magic, PICO_LOG_MAGIC, 4);
+        fwrite(&hdr, sizeof(hdr), 1, f);
+    } else {
+        assert(fread(&hdr, sizeof(hdr), 1, f) == 1 &&
+               memcmp(hdr.magic, PICO_LOG_MAGIC, 4) == 0 &&
+               hdr.version == PICO_LOG_VERSION && "invalid input log");
+    }
+    return f;
+}
+
 // Pre-handles input from environment:
 //  - SDL_QUIT: quit
 //  - CTRL_-/=: zoom
-//  - CTRL_L/R/U/D: scroll
+//  - CTRL_L/R/U/D: pan the view
 //  - receives:
-//      - e:  actual input
-//      - xp: input I was expecting
+//      - e:   actual input
+//      - xps: inputs I was expecting, any of them
 //  - returns
-//      - 1: if e matches xp
+//      - 1: if e matches one of xps
 //      - 0: otherwise
-static int event_from_sdl (Pico_Event* e, int xp) {
+static int event_from_sdl_set (Pico_Event* e, const int xps[], int n) {
+    if (_pico_log.rec!=NULL && _pico_log_input(e->type)) {
+        _pico_log_write(e);
+    }
+    if (e->type == _pico_music.evt) {
+        _pico_music_next();
+        return 0;
+    }
     switch (e->type) {
         case SDL_QUIT: {
             if (!S.expert) {
@@ -192,57 +1166,73 @@ static int event_from_sdl (Pico_Event* e, int xp) {
             break;
         }
 
+        case SDL_WINDOWEVENT: {
+            // software rendering only updates dirty regions, so a window
+            // that gets uncovered needs a full present
+            if (e->window.event == SDL_WINDOWEVENT_EXPOSED) {
+                _pico_sync();
+                _pico_dirty_all();
+                _pico_output_present(0);
+            }
+            break;
+        }
+
+        case SDL_KEYMAPCHANGED: {
+            memset(_pico_input.ascii, 0, sizeof(_pico_input.ascii));
+            break;
+        }
+
         case SDL_KEYDOWN: {
-            const unsigned char* state = SDL_GetKeyboardState(NULL);
-            if (!state[SDL_SCANCODE_LCTRL] && !state[SDL_SCANCODE_RCTRL]) {
+            if (!(e->key.keysym.mod & KMOD_CTRL)) {
                 break;
             }
             switch (e->key.keysym.sym) {
                 case SDLK_0: {
+                    _pico_sync();
+                    S.view.pan = (Pico_Pos) {0, 0};
                     pico_set_zoom((Pico_Dim){100, 100});
-                    pico_set_scroll((Pico_Pos){0, 0});
                     break;
                 }
                 case SDLK_MINUS: {
                     pico_set_zoom ((Pico_Dim) {
-                        MAX(1, S.zoom.x-10),
-                        MAX(1, S.zoom.y-10)
+                        MAX(1, S.view.zoom.x-10),
+                        MAX(1, S.view.zoom.y-10)
                     });
                     break;
                 }
                 case SDLK_EQUALS: {
                     pico_set_zoom ((Pico_Dim) {
-                        S.zoom.x + 10,
-                        S.zoom.y + 10
+                        S.view.zoom.x + 10,
+                        S.view.zoom.y + 10
                     });
                     break;
                 }
                 case SDLK_LEFT: {
-                    pico_set_scroll ((Pico_Pos) {
-                        S.scroll.x - MAX(1, S.size.cur.x/20),
-                        S.scroll.y
-                    });
+                    _pico_sync();
+                    S.view.pan.x -= MAX(1, S.size.cur.x/20);
+                    _pico_dirty_all();
+                    _pico_output_present(0);
                     break;
                 }
                 case SDLK_RIGHT: {
-                    pico_set_scroll ((Pico_Pos) {
-                        S.scroll.x + MAX(1, S.size.cur.x/20),
-                        S.scroll.y
-                    });
+                    _pico_sync();
+                    S.view.pan.x += MAX(1, S.size.cur.x/20);
+                    _pico_dirty_all();
+                    _pico_output_present(0);
                     break;
                 }
                 case SDLK_UP: {
-                    pico_set_scroll ((Pico_Pos) {
-                        S.scroll.x,
-                        S.scroll.y - MAX(1, S.size.cur.y/20)
-                    });
+                    _pico_sync();
+                    S.view.pan.y -= MAX(1, S.size.cur.y/20);
+                    _pico_dirty_all();
+                    _pico_output_present(0);
                     break;
                 }
                 case SDLK_DOWN: {
-                    pico_set_scroll ((Pico_Pos) {
-                        S.scroll.x,
-                        S.scroll.y + MAX(1, S.size.cur.y/20)
-                    });
+                    _pico_sync();
+                    S.view.pan.y += MAX(1, S.size.cur.y/20);
+                    _pico_dirty_all();
+                    _pico_output_present(0);
                     break;
                 }
                 case SDLK_g: {
@@ -270,20 +1260,18 @@ static int event_from_sdl (Pico_Event* e, int xp) {
             break;
     }
 
-    if (xp == (int)e->type) {
-        // OK
-    } else if (xp == SDL_ANY) {
-        // MAYBE
-        if (e->type==SDL_KEYDOWN || e->type==SDL_KEYUP || e->type==SDL_MOUSEBUTTONDOWN ||
-            e->type==SDL_MOUSEBUTTONUP || e->type==SDL_MOUSEMOTION ||
-            e->type==SDL_QUIT) {
-            // OK
-        } else {
-            // NO
-            return 0;   // not the one I was expecting
+    int ok = 0;
+    for (int i=0; i<n && !ok; i++) {
+        if (xps[i] == (int)e->type) {
+            ok = 1;     // OK
+        } else if (xps[i] == SDL_ANY) {
+            // MAYBE
+            ok = (e->type==SDL_KEYDOWN || e->type==SDL_KEYUP || e->type==SDL_MOUSEBUTTONDOWN ||
+                  e->type==SDL_MOUSEBUTTONUP || e->type==SDL_MOUSEMOTION ||
+                  e->type==SDL_QUIT);
         }
-    } else {
-        // NO
+    }
+    if (!ok) {
         return 0;   // not the one I was expecting
     }
 
@@ -291,36 +1279,143 @@ static int event_from_sdl (Pico_Event* e, int xp) {
     switch (e->type) {
         case SDL_MOUSEBUTTONDOWN:
         case SDL_MOUSEBUTTONUP:
-        case SDL_MOUSEMOTION:
-            e->button.x = (e->button.x + S.scroll.x);
-            e->button.y = (e->button.y + S.scroll.y);
+        case SDL_MOUSEMOTION: {
+            Pico_Rect view = _pico_view();
+            Pico_Pos pos = _pico_camera_unmap ((Pico_Pos) {
+                e->button.x + view.x,
+                e->button.y + view.y
+            });
+            e->button.x = (pos.x + S.scroll.x);
+            e->button.y = (pos.y + S.scroll.y);
             break;
+        }
         default:
             break;
     }
     return 1;
 }
 
-void pico_input_delay (int ms) {
-    while (1) {
-        int old = SDL_GetTicks();
-        Pico_Event e;
-        int has = SDL_WaitEventTimeout(&e, ms);
-        if (has) {
-            event_from_sdl(&e, SDL_ANY);
-        }
-        int dt = SDL_GetTicks() - old;
-        ms -= dt;
-        if (ms <= 0) {
-            return;
+// Same as event_from_sdl_set, for an event just taken from the queue:
+// merges it with the mouse motions right behind it, only consecutive ones,
+// so the order with other events holds.
+static int event_from_queue (Pico_Event* e, const int xps[], int n) {
+    // replayed motions were merged when recorded
+    if (e->type==SDL_MOUSEMOTION && _pico_log.rep==NULL) {
+        Pico_Event nxt;
+        while (SDL_PeepEvents(&nxt, 1, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1
+            && nxt.type == SDL_MOUSEMOTION) {
+            SDL_PeepEvents(&nxt, 1, SDL_GETEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+            nxt.motion.xrel += e->motion.xrel;
+            nxt.motion.yrel += e->motion.yrel;
+            *e = nxt;
         }
     }
+    return event_from_sdl_set(e, xps, n);
 }
 
-void pico_input_event (Pico_Event* evt, int type) {
+static int event_from_sdl (Pico_Event* e, int xp) {
+    return event_from_queue(e, &xp, 1);
+}
+
+// Sleeping in SDL may overshoot by a millisecond or two, so waits sleep
+// until this close to the deadline and then spin on the counter.
+#define PICO_SPIN 2
+
+#define PICO_FOREVER UINT64_MAX
+
+// Whole seconds apart, so that long waits do not overflow.
+static Uint64 _pico_deadline (Uint64 us) {
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    return _pico_now() + (us/1000000)*freq + (us%1000000)*freq/1000000;
+}
+
+static int _pico_wait_until (Pico_Event* e, Uint64 end);
+
+// Takes the next event from the log once its time comes. Live user input
+// is dropped meanwhile, and the rest of the events pass through.
+static int _pico_replay_next (Pico_Event* e, Uint64 end) {
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    while (1) {
+        SDL_PumpEvents();
+        SDL_FlushEvent(SDL_QUIT);
+        SDL_FlushEvents(SDL_KEYDOWN, SDL_MOUSEWHEEL);
+        if (SDL_PeepEvents(e, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1) {
+            return 1;
+        }
+
+        // back to live input at the end of the log
+        if (!_pico_log.nxt.has) {
+            fclose(_pico_log.rep);
+            _pico_log.rep = NULL;
+            _pico_log.skew = _pico_log.virt - SDL_GetPerformanceCounter();
+            return _pico_wait_until(e, end);
+        }
+
+        Uint64 now = _pico_now();
+        if (_pico_log.fast) {
+            if (_pico_log.nxt.at > end) {
+                _pico_log.virt = MAX(now, end);     // polls do not rewind
+                return 0;
+            }
+            _pico_log.virt = MAX(now, _pico_log.nxt.at);
+        } else if (_pico_log.nxt.at > now) {
+            if (now >= end) {
+                return 0;
+            }
+            Uint64 ms = (SDL_min(end,_pico_log.nxt.at) - now) * 1000 / freq;
+            if (ms > PICO_SPIN) {
+                SDL_WaitEventTimeout(NULL, ms - PICO_SPIN);
+            }
+            continue;
+        }
+        *e = _pico_log.nxt.evt;
+        _pico_log_read();
+        return 1;
+    }
+}
+
+// Waits for an event until a deadline in performance counter units, or
+// PICO_FOREVER. Returns 0 once the deadline is reached and no event is
+// pending.
+static int _pico_wait_until (Pico_Event* e, Uint64 end) {
+    if (_pico_log.rep != NULL) {
+        return _pico_replay_next(e, end);
+    } else if (end == PICO_FOREVER) {
+        return SDL_WaitEvent(e);
+    }
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    while (1) {
+        Uint64 now = _pico_now();
+        if (now >= end) {
+            return SDL_PollEvent(e);
+        }
+        Uint64 ms = (end - now) * 1000 / freq;
+        if (ms > PICO_SPIN) {
+            if (SDL_WaitEventTimeout(e, SDL_min(ms-PICO_SPIN, SDL_MAX_SINT32))) {
+                return 1;
+            }
+        } else if (SDL_PollEvent(e)) {
+            return 1;
+        }
+    }
+}
+
+void pico_input_delay (int ms) {
+    pico_input_delay_us((ms < 0) ? 0 : (Uint64)ms*1000);
+}
+
+void pico_input_delay_us (Uint64 us) {
+    Uint64 end = _pico_deadline(us);
+    Pico_Event e;
+    while (_pico_wait_until(&e, end)) {
+        event_from_sdl(&e, SDL_ANY);
+    }
+}
+
+void pico_input_event (Pico_Event* evt, int type) {
     while (1) {
         Pico_Event x;
-        SDL_WaitEvent(&x);
+        _pico_wait_until(&x, PICO_FOREVER);
         if (event_from_sdl(&x, type)) {
             if (evt != NULL) {
                 *evt = x;
@@ -331,46 +1426,627 @@ void pico_input_event (Pico_Event* evt, int type) {
 }
 
 int pico_input_event_ask (Pico_Event* evt, int type) {
-    int has = SDL_PollEvent(evt);
+    int has = _pico_wait_until(evt, 0);
     if (!has) return 0;
     return event_from_sdl(evt, type);
 }
 
+// Returns at the first event, even of another type, as it always did.
 int pico_input_event_timeout (Pico_Event* evt, int type, int timeout) {
-    int has = SDL_WaitEventTimeout(evt, timeout);
-    if (!has) {
+    Uint64 end = (timeout < 0) ? PICO_FOREVER : _pico_deadline((Uint64)timeout * 1000);
+    Pico_Event x;
+    if (!_pico_wait_until(&x, end) || !event_from_sdl(&x, type)) {
         return 0;
     }
-    if (event_from_sdl(evt, type)) {
-        return 1;
+    if (evt != NULL) {
+        *evt = x;
     }
-    return 0;
+    return 1;
+}
+
+int pico_input_event_any (Pico_Event* evt, const int types[], int n, int timeout) {
+    Uint64 end = (timeout < 0) ? PICO_FOREVER : _pico_deadline((Uint64)timeout * 1000);
+    while (1) {
+        Pico_Event x;
+        int has = _pico_wait_until(&x, end);
+        if (!has) {
+            return 0;
+        }
+        if (event_from_queue(&x, types, n)) {
+            if (evt != NULL) {
+                *evt = x;
+            }
+            return 1;
+        }
+    }
+}
+
+int pico_input_events (Pico_Event buf[], int max, const int types[], int n) {
+    int got = 0;
+    if (_pico_log.rep != NULL) {
+        Pico_Event x;
+        while (got<max && _pico_wait_until(&x, 0)) {
+            if (event_from_sdl_set(&x, types, n)) {
+                buf[got++] = x;
+            }
+        }
+        return got;
+    }
+    SDL_PumpEvents();
+    while (got < max) {
+        // never takes more than fits, so no matching event is lost
+        Pico_Event tmp[64];
+        int k = SDL_PeepEvents(tmp, SDL_min(64, max-got), SDL_GETEVENT,
+                               SDL_FIRSTEVENT, SDL_LASTEVENT);
+        if (k <= 0) {
+            break;
+        }
+        for (int i=0; i<k; i++) {
+            if (i+1<k && tmp[i].type==SDL_MOUSEMOTION && tmp[i+1].type==SDL_MOUSEMOTION) {
+                tmp[i+1].motion.xrel += tmp[i].motion.xrel;
+                tmp[i+1].motion.yrel += tmp[i].motion.yrel;
+                continue;
+            }
+            // only the last one has the queue right behind it
+            int ok = (i+1 < k) ? event_from_sdl_set(&tmp[i], types, n)
+                               : event_from_queue(&tmp[i], types, n);
+            if (ok) {
+                buf[got++] = tmp[i];
+            }
+        }
+    }
+    return got;
+}
+
+// Window to logical coordinates, as SDL maps events under a logical size:
+// uniform scale, centered.
+static Pico_Pos _pico_logical (int x, int y) {
+    Pico_Dim phy = PHY;
+    float sx = (float)phy.x / S.size.cur.x;
+    float sy = (float)phy.y / S.size.cur.y;
+    float s  = (sx < sy) ? sx : sy;
+    return (Pico_Pos) {
+        (x - (phy.x - S.size.cur.x*s)/2) / s,
+        (y - (phy.y - S.size.cur.y*s)/2) / s,
+    };
+}
+
+void pico_input_poll (void) {
+    SDL_PumpEvents();
+    if (SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_KEYMAPCHANGED, SDL_KEYMAPCHANGED) > 0) {
+        memset(_pico_input.ascii, 0, sizeof(_pico_input.ascii));
+    }
+
+    memcpy(_pico_input.keys.old, _pico_input.keys.now, sizeof(_pico_input.keys.now));
+    memset(_pico_input.keys.now, 0, sizeof(_pico_input.keys.now));
+    const Uint8* state = SDL_GetKeyboardState(NULL);
+    for (int i=0; i<SDL_NUM_SCANCODES; i++) {
+        _pico_input.keys.now[i/32] |= (Uint32)(state[i] != 0) << (i%32);
+    }
+
+    int x, y;
+    _pico_input.buttons.old = _pico_input.buttons.now;
+    _pico_input.buttons.now = SDL_GetMouseState(&x, &y);
+    Pico_Pos pos = _pico_logical(x, y);
+    Pico_Rect view = _pico_view();
+    pos = _pico_camera_unmap((Pico_Pos) { pos.x+view.x, pos.y+view.y });
+    _pico_input.mouse = (Pico_Pos) {
+        pos.x + S.scroll.x,
+        pos.y + S.scroll.y,
+    };
+}
+
+// Keys outside the printable range already encode their scancode.
+static SDL_Scancode _pico_input_scan (int key) {
+    if (key & SDLK_SCANCODE_MASK) {
+        return key & ~SDLK_SCANCODE_MASK;
+    } else if (0<=key && key<128) {
+        if (_pico_input.ascii[key] == SDL_SCANCODE_UNKNOWN) {
+            _pico_input.ascii[key] = SDL_GetScancodeFromKey(key);
+        }
+        return _pico_input.ascii[key];
+    } else {
+        return SDL_GetScancodeFromKey(key);
+    }
+}
+
+static int _pico_input_bit (const Uint32* keys, int key) {
+    SDL_Scancode sc = _pico_input_scan(key);
+    if (sc<=SDL_SCANCODE_UNKNOWN || sc>=SDL_NUM_SCANCODES) {
+        return 0;
+    }
+    return (keys[sc/32] >> (sc%32)) & 1;
 }
 
 // OUTPUT
 
-static void _pico_output_clear (void) {
-    SDL_SetRenderDrawColor (REN,
-        S.color.clear.r,
-        S.color.clear.g,
-        S.color.clear.b,
-        S.color.clear.a
-    );
-    SDL_RenderClear(REN);
-    SDL_SetRenderDrawColor (REN,
-        S.color.draw.r,
-        S.color.draw.g,
-        S.color.draw.b,
-        S.color.draw.a
+// Draws quads of 4 corners each, with one color per corner (render side).
+static void _pico_geom (const float* xy, const SDL_Color* col, int n) {
+    if (n > _pico_quads.n) {
+        _pico_quads.vec = realloc(_pico_quads.vec, 6*n*sizeof(int));
+        assert(_pico_quads.vec != NULL && "cannot allocate geometry");
+        for (int i=_pico_quads.n; i<n; i++) {
+            int* q = &_pico_quads.vec[6*i];
+            q[0]=4*i+0; q[1]=4*i+1; q[2]=4*i+2;
+            q[3]=4*i+2; q[4]=4*i+1; q[5]=4*i+3;
+        }
+        _pico_quads.n = n;
+    }
+    _pico_blend(SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometryRaw (
+        REN, NULL, xy, 2*sizeof(float), col, sizeof(SDL_Color),
+        NULL, 0, 4*n, _pico_quads.vec, 6*n, sizeof(int)
     );
 }
 
-static void _pico_output_present (int force);
-void pico_output_clear (void) {
-    _pico_output_clear();
+static float* _pico_cam_quad (float* q, float x, float y, float w, float h) {
+    q[0]=x;   q[1]=y;
+    q[2]=x+w; q[3]=y;
+    q[4]=x;   q[5]=y+h;
+    q[6]=x+w; q[7]=y+h;
+    return q + 8;
+}
+
+// Maps all corners in a single pass and draws them in a single call.
+// Without colors, all corners take the given one.
+static void _pico_batch_flush (void) {
+    if (_pico_batch.n == 0) {
+        return;
+    }
+    _pico_geom(_pico_batch.xy, _pico_batch.col, _pico_batch.n);
+    _pico_dirty_add(_pico_batch.r);
+    _pico_batch.n = 0;
+}
+
+// Maps all corners in a single pass into the batch, which is drawn later.
+// Without colors, all corners take the given one.
+static void _pico_cam_draw (const float* xy, const SDL_Color* col, Pico_Color c, int n, Pico_Pos off) {
+    if (n == 0) {
+        return;
+    }
+    if (_pico_batch.n+n > _pico_batch.max) {
+        _pico_batch.max = MAX(_pico_batch.n+n, 2*_pico_batch.max);
+        _pico_batch.xy  = realloc(_pico_batch.xy, 8*_pico_batch.max*sizeof(float));
+        _pico_batch.col = realloc(_pico_batch.col, 4*_pico_batch.max*sizeof(SDL_Color));
+        assert(_pico_batch.xy!=NULL && _pico_batch.col!=NULL && "cannot allocate geometry");
+    }
+    const float m0=_pico_cam.m[0], m1=_pico_cam.m[1], m2=_pico_cam.m[2];
+    const float m3=_pico_cam.m[3], m4=_pico_cam.m[4], m5=_pico_cam.m[5];
+    const float ox=off.x, oy=off.y;
+    float* restrict v = &_pico_batch.xy[8*_pico_batch.n];
+    for (int i=0; i<8*n; i+=2) {
+        float x = xy[i+0] + ox;
+        float y = xy[i+1] + oy;
+        v[i+0] = m0*x + m1*y + m2;
+        v[i+1] = m3*x + m4*y + m5;
+    }
+    SDL_Color* k = &_pico_batch.col[4*_pico_batch.n];
+    if (col == NULL) {
+        for (int i=0; i<4*n; i++) {
+            k[i] = c;
+        }
+    } else {
+        memcpy(k, col, 4*n*sizeof(SDL_Color));
+    }
+
+    float x0=v[0], y0=v[1], x1=x0, y1=y0;
+    for (int i=2; i<8*n; i+=2) {
+        x0 = (v[i+0] < x0) ? v[i+0] : x0;
+        y0 = (v[i+1] < y0) ? v[i+1] : y0;
+        x1 = (v[i+0] > x1) ? v[i+0] : x1;
+        y1 = (v[i+1] > y1) ? v[i+1] : y1;
+    }
+    Pico_Rect r = {
+        SDL_floorf(x0)-1, SDL_floorf(y0)-1,
+        SDL_ceilf(x1)-SDL_floorf(x0)+2, SDL_ceilf(y1)-SDL_floorf(y0)+2
+    };
+    if (_pico_batch.n == 0) {
+        _pico_batch.r = r;
+    } else {
+        SDL_UnionRect(&_pico_batch.r, &r, &_pico_batch.r);
+    }
+    _pico_batch.n += n;
+}
+
+// Under a camera, commands become quads in target coordinates, so that
+// pixels, lines and outlines scale and rotate with the rest, and then go
+// through the camera together. Consecutive ones share a single batch.
+// Copies keep their texture and take float rectangles, after the batch.
+// Returns 0 for commands the camera does not affect.
+static int _pico_cam_exec (const Pico_Cmd* c, Pico_Pos off) {
+    Pico_Arena* a = &_pico_frame.ren;
+    switch (c->op) {
+        case PICO_CMD_COPY: {
+            _pico_batch_flush();
+            const float* m = _pico_cam.m;
+            Pico_Rect d = c->copy.dst;
+            float x = d.x + off.x + d.w/2.0f;
+            float y = d.y + off.y + d.h/2.0f;
+            float z = _pico_cam.cam.zoom;
+            SDL_FRect dst = {
+                m[0]*x + m[1]*y + m[2] - z*d.w/2,
+                m[3]*x + m[4]*y + m[5] - z*d.h/2,
+                z*d.w, z*d.h
+            };
+            float angle = c->copy.angle + _pico_cam.cam.angle;
+            SDL_Texture* tex = c->copy.tex;
+            if (tex == NULL) {
+                tex = SDL_CreateTextureFromSurface(REN, c->copy.sfc);
+                pico_assert(tex != NULL);
+            }
+            SDL_RenderCopyExF (
+                REN, tex,
+                (c->copy.crp.w == 0) ? NULL : &c->copy.crp, &dst,
+                angle, NULL, (SDL_RendererFlip)c->copy.flip
+            );
+            if (tex != c->copy.tex) {
+                SDL_DestroyTexture(tex);
+            }
+            _pico_dirty_add_rotated ((Pico_Rect) {
+                SDL_floorf(dst.x), SDL_floorf(dst.y),
+                SDL_ceilf(dst.w)+1, SDL_ceilf(dst.h)+1
+            }, angle);
+            return 1;
+        }
+        case PICO_CMD_GEOM: {
+            _pico_cam_draw(c->geom.xy, c->geom.col, c->color, c->geom.n, off);
+            return 1;
+        }
+        case PICO_CMD_LINE: {
+            // one pixel wide, from the center of each end pixel
+            float x1 = c->line.p1.x + 0.5f, y1 = c->line.p1.y + 0.5f;
+            float x2 = c->line.p2.x + 0.5f, y2 = c->line.p2.y + 0.5f;
+            float dx = x2-x1, dy = y2-y1;
+            float len = SDL_sqrtf(dx*dx + dy*dy);
+            float ex = (len == 0) ? 0.5f : 0.5f*dx/len;
+            float ey = (len == 0) ? 0    : 0.5f*dy/len;
+            float* q = _pico_arena_alloc(a, 8*sizeof(float));
+            q[0]=x1-ex-ey; q[1]=y1-ey+ex;
+            q[2]=x2+ex-ey; q[3]=y2+ey+ex;
+            q[4]=x1-ex+ey; q[5]=y1-ey-ex;
+            q[6]=x2+ex+ey; q[7]=y2+ey-ex;
+            _pico_cam_draw(q, NULL, c->color, 1, off);
+            return 1;
+        }
+        case PICO_CMD_OVAL: {
+            Pico_Rect r = c->rect.r;
+            float cx = r.x + r.w/2.0f, cy = r.y + r.h/2.0f;
+            float rx = r.w/2.0f, ry = r.h/2.0f;
+            int k = (r.w + r.h) * _pico_cam.cam.zoom;
+            k = (k < 16) ? 16 : (k > 512) ? 512 : k;
+            // fill: degenerate quads fan out from the center
+            // stroke: quads join the outer and inner borders
+            float in = (c->rect.style == PICO_FILL) ? 0 : 1;
+            float ix = (rx > in) ? rx-in : 0;
+            float iy = (ry > in) ? ry-in : 0;
+            float* xy = _pico_arena_alloc(a, 8*k*sizeof(float));
+            for (int i=0; i<k; i++) {
+                float a0 = 2 * M_PI * i / k;
+                float a1 = 2 * M_PI * (i+1) / k;
+                float c0=SDL_cosf(a0), s0=SDL_sinf(a0);
+                float c1=SDL_cosf(a1), s1=SDL_sinf(a1);
+                float* q = &xy[8*i];
+                q[0]=cx+rx*c0; q[1]=cy+ry*s0;
+                q[2]=cx+rx*c1; q[3]=cy+ry*s1;
+                q[4]=cx+ix*c0; q[5]=cy+iy*s0;
+                q[6]=cx+ix*c1; q[7]=cy+iy*s1;
+            }
+            _pico_cam_draw(xy, NULL, c->color, k, off);
+            return 1;
+        }
+        case PICO_CMD_PIXEL: {
+            float* q = _pico_arena_alloc(a, 8*sizeof(float));
+            _pico_cam_quad(q, c->pixel.x, c->pixel.y, 1, 1);
+            _pico_cam_draw(q, NULL, c->color, 1, off);
+            return 1;
+        }
+        case PICO_CMD_PIXELS: {
+            int n = c->pixels.n;
+            float* xy = _pico_arena_alloc(a, 8*n*sizeof(float));
+            float* q = xy;
+            for (int i=0; i<n; i++) {
+                q = _pico_cam_quad(q, c->pixels.vec[i].x, c->pixels.vec[i].y, 1, 1);
+            }
+            _pico_cam_draw(xy, NULL, c->color, n, off);
+            return 1;
+        }
+        case PICO_CMD_RECT: {
+            Pico_Rect r = c->rect.r;
+            float* xy = _pico_arena_alloc(a, 4*8*sizeof(float));
+            float* q = xy;
+            if (c->rect.style == PICO_FILL) {
+                q = _pico_cam_quad(q, r.x, r.y, r.w, r.h);
+            } else {
+                int h = MAX(0, r.h-2);
+                q = _pico_cam_quad(q, r.x,       r.y,       r.w, 1);
+                q = _pico_cam_quad(q, r.x,       r.y+r.h-1, r.w, 1);
+                q = _pico_cam_quad(q, r.x,       r.y+1,     1,   h);
+                q = _pico_cam_quad(q, r.x+r.w-1, r.y+1,     1,   h);
+            }
+            _pico_cam_draw(xy, NULL, c->color, (q-xy)/8, off);
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+static void _pico_cmd_exec (const Pico_Cmd* c, Pico_Pos off) {
+    if (_pico_cam.on && _pico_cam_exec(c, off)) {
+        return;
+    }
+    if (c->op != PICO_CMD_LIST) {
+        _pico_batch_flush();        // lists may go on with the batch
+    }
+    switch (c->op) {
+        case PICO_CMD_CALL: {
+            c->call.f(c->call.arg);
+            break;
+        }
+        case PICO_CMD_CAMERA: {
+            _pico_cam_set(c->camera);
+            break;
+        }
+        case PICO_CMD_CLEAR: {
+            _pico_color(c->color);
+            SDL_RenderClear(REN);
+            _pico_dirty_all();
+            break;
+        }
+        case PICO_CMD_COPY: {
+            Pico_Rect dst = c->copy.dst;
+            dst.x += off.x;
+            dst.y += off.y;
+            SDL_Texture* tex = c->copy.tex;
+            if (tex == NULL) {
+                tex = SDL_CreateTextureFromSurface(REN, c->copy.sfc);
+                pico_assert(tex != NULL);
+            }
+            SDL_RenderCopyEx (
+                REN, tex,
+                (c->copy.crp.w == 0) ? NULL : &c->copy.crp, &dst,
+                c->copy.angle, NULL, (SDL_RendererFlip)c->copy.flip
+            );
+            if (tex != c->copy.tex) {
+                SDL_DestroyTexture(tex);
+            }
+            _pico_dirty_add_rotated(dst, c->copy.angle);
+            break;
+        }
+        case PICO_CMD_GEOM: {
+            int n = c->geom.n;
+            const float* xy = c->geom.xy;
+            Pico_Rect r = c->geom.r;
+            if (off.x!=0 || off.y!=0) {
+                float* tmp = _pico_arena_alloc(&_pico_frame.ren, 8*n*sizeof(float));
+                for (int i=0; i<8*n; i+=2) {
+                    tmp[i+0] = xy[i+0] + off.x;
+                    tmp[i+1] = xy[i+1] + off.y;
+                }
+                xy = tmp;
+                r.x += off.x;
+                r.y += off.y;
+            }
+            _pico_geom(xy, c->geom.col, n);
+            _pico_dirty_add(r);
+            break;
+        }
+        case PICO_CMD_LINE: {
+            SDL_Point pts[2] = {
+                { c->line.p1.x+off.x, c->line.p1.y+off.y },
+                { c->line.p2.x+off.x, c->line.p2.y+off.y },
+            };
+            _pico_color_blend(c->color, SDL_BLENDMODE_BLEND);
+            SDL_RenderDrawLine(REN, pts[0].x,pts[0].y, pts[1].x,pts[1].y);
+            Pico_Rect r;
+            SDL_EnclosePoints(pts, 2, NULL, &r);
+            _pico_dirty_add(r);
+            break;
+        }
+        case PICO_CMD_LIST: {
+            _pico_list_exec (c->list.l, (Pico_Pos) {
+                c->list.off.x + off.x,
+                c->list.off.y + off.y
+            });
+            break;
+        }
+        case PICO_CMD_OVAL: {
+            Pico_Rect out = c->rect.r;
+            out.x += off.x;
+            out.y += off.y;
+            switch (c->rect.style) {
+                case PICO_FILL:
+                    filledEllipseRGBA (
+                        REN,
+                        out.x+out.w/2, out.y+out.h/2, out.w/2, out.h/2,
+                        c->color.r, c->color.g, c->color.b, c->color.a
+                    );
+                    break;
+                case PICO_STROKE:
+                    ellipseRGBA (
+                        REN,
+                        out.x+out.w/2, out.y+out.h/2, out.w/2, out.h/2,
+                        c->color.r, c->color.g, c->color.b, c->color.a
+                    );
+                    break;
+            }
+            _pico_ren.ok = 0;   // gfx sets color and blend mode
+            _pico_dirty_add((Pico_Rect) { out.x-1, out.y-1, out.w+2, out.h+2 });
+            break;
+        }
+        case PICO_CMD_PIXEL: {
+            Pico_Rect r = { c->pixel.x+off.x, c->pixel.y+off.y, 1, 1 };
+            _pico_color_blend(c->color, SDL_BLENDMODE_BLEND);
+            SDL_RenderDrawPoint(REN, r.x, r.y);
+            _pico_dirty_add(r);
+            break;
+        }
+        case PICO_CMD_PIXELS: {
+            int n = c->pixels.n;
+            const Pico_Pos* vec = c->pixels.vec;
+            if (off.x!=0 || off.y!=0) {
+                Pico_Pos* tmp = _pico_arena_alloc(&_pico_frame.ren, n*sizeof(Pico_Pos));
+                for (int i=0; i<n; i++) {
+                    tmp[i] = (Pico_Pos) { vec[i].x+off.x, vec[i].y+off.y };
+                }
+                vec = tmp;
+            }
+            _pico_color_blend(c->color, SDL_BLENDMODE_BLEND);
+            SDL_RenderDrawPoints(REN, vec, n);
+            Pico_Rect r;
+            if (SDL_EnclosePoints(vec, n, NULL, &r)) {
+                _pico_dirty_add(r);
+            }
+            break;
+        }
+        case PICO_CMD_PRESENT: {
+            _pico_present();
+            break;
+        }
+        case PICO_CMD_RECT: {
+            Pico_Rect out = c->rect.r;
+            out.x += off.x;
+            out.y += off.y;
+            _pico_color_blend(c->color, SDL_BLENDMODE_BLEND);
+            switch (c->rect.style) {
+                case PICO_FILL:
+                    SDL_RenderFillRect(REN, &out);
+                    break;
+                case PICO_STROKE:
+                    SDL_RenderDrawRect(REN, &out);
+                    break;
+            }
+            _pico_dirty_add(out);
+            break;
+        }
+    }
+}
+
+static void _pico_cmd_free (Pico_Cmd* c) {
+    if (c->op==PICO_CMD_GEOM && c->geom.own) {
+        free(c->geom.xy);
+    }
+    if (c->op!=PICO_CMD_COPY || !c->copy.own) {
+        return;
+    }
+    if (c->copy.tex != NULL) {
+        SDL_DestroyTexture(c->copy.tex);
+    }
+    if (c->copy.sfc != NULL) {
+        SDL_FreeSurface(c->copy.sfc);
+    }
+}
+
+// Recorded copies keep a texture instead of the surface (render side).
+static void _pico_cmd_tex (void* arg) {
+    Pico_Cmd* c = arg;
+    c->copy.tex = SDL_CreateTextureFromSurface(REN, c->copy.sfc);
+    pico_assert(c->copy.tex != NULL);
+    SDL_FreeSurface(c->copy.sfc);
+    c->copy.sfc = NULL;
+}
+
+static void _pico_list_exec (Pico_List* l, Pico_Pos off) {
+    for (int i=0; i<l->n; i++) {
+        const Pico_Cmd* c = &l->cmds[i];
+        if (c->op == PICO_CMD_PIXELS) {
+            Pico_Cmd t = *c;
+            t.pixels.vec = &l->pts[c->pixels.i];
+            _pico_cmd_exec(&t, off);
+        } else {
+            _pico_cmd_exec(c, off);
+        }
+    }
+}
+
+static void _pico_list_reset (Pico_List* l) {
+    for (int i=0; i<l->n; i++) {
+        _pico_cmd_free(&l->cmds[i]);
+    }
+    l->n = 0;
+    l->pts_n = 0;
+}
+
+static void _pico_list_clear (void* l) {
+    _pico_list_reset(l);
+}
+
+static void _pico_lists_destroy (void) {
+    while (_pico_lists.all != NULL) {
+        Pico_List* l = _pico_lists.all;
+        _pico_lists.all = l->next;
+        _pico_list_reset(l);
+        free(l->cmds);
+        free(l->pts);
+        free(l->name);
+        free(l);
+    }
+    _pico_lists.rec = NULL;
+    pico_hash_destroy(_pico_lists.hash);
+}
+
+// Appends a command to a list, which takes a copy of its points.
+static void _pico_list_push (Pico_List* l, Pico_Cmd c) {
+    if (c.op == PICO_CMD_GEOM) {
+        size_t xy = 8*c.geom.n*sizeof(float);
+        char* blk = malloc(xy + 4*c.geom.n*sizeof(SDL_Color));
+        assert(blk != NULL && "cannot record list");
+        memcpy(blk, c.geom.xy, xy);
+        memcpy(blk+xy, c.geom.col, 4*c.geom.n*sizeof(SDL_Color));
+        c.geom.xy  = (float*) blk;
+        c.geom.col = (SDL_Color*) (blk + xy);
+        c.geom.own = 1;
+    }
+    if (c.op == PICO_CMD_PIXELS) {
+        if (l->pts_n+c.pixels.n > l->pts_max) {
+            l->pts_max = MAX(l->pts_n+c.pixels.n, 2*l->pts_max);
+            l->pts = realloc(l->pts, l->pts_max*sizeof(Pico_Pos));
+            assert(l->pts != NULL && "cannot record list");
+        }
+        memcpy(&l->pts[l->pts_n], c.pixels.vec, c.pixels.n*sizeof(Pico_Pos));
+        c.pixels.vec = NULL;
+        c.pixels.i = l->pts_n;
+        l->pts_n += c.pixels.n;
+    }
+    if (l->n == l->max) {
+        l->max = MAX(16, 2*l->max);
+        l->cmds = realloc(l->cmds, l->max*sizeof(Pico_Cmd));
+        assert(l->cmds != NULL && "cannot record list");
+    }
+    l->cmds[l->n++] = c;
+}
+
+// Executes a command, or queues it for the render thread.
+static void _pico_cmd_run (Pico_Cmd c) {
+    if (_pico_render_side()) {
+        _pico_cmd_exec(&c, (Pico_Pos){0,0});
+        _pico_cmd_free(&c);
+    } else {
+        _pico_list_push(&_pico_thread.buf[_pico_thread.cur], c);
+    }
+}
+
+// Executes, records, and presents a drawing operation.
+// The list being recorded, if any, takes over what the command owns.
+static void _pico_output_cmd (Pico_Cmd c) {
+    Pico_List* rec = _pico_lists.rec;
+    if (rec != NULL) {
+        if (c.op==PICO_CMD_COPY && c.copy.sfc!=NULL) {
+            _pico_call(_pico_cmd_tex, &c);
+        }
+        _pico_list_push(rec, c);
+        if (c.op == PICO_CMD_COPY) {
+            c.copy.own = 0;
+        }
+    }
+    _pico_cmd_run(c);
     _pico_output_present(0);
 }
 
+void pico_output_clear (void) {
+    _pico_output_cmd((Pico_Cmd) { .op=PICO_CMD_CLEAR, .color=S.color.clear });
+}
+
 void pico_output_draw_buffer (Pico_Pos pos, const Pico_Color buffer[], Pico_Dim size) {
     Pico_Color old = pico_get_color_draw();
     int x = X(pos.x, size.x);
@@ -385,7 +2061,7 @@ void pico_output_draw_buffer (Pico_Pos pos, const Pico_Color buffer[], Pico_Dim
     pico_set_color_draw(old);
 }
 
-static void _pico_output_draw_image_tex (Pico_Pos pos, SDL_Texture* tex) {
+static void _pico_output_draw_image_tex (Pico_Pos pos, SDL_Texture* tex, int own) {
     Pico_Rect rct;
     SDL_QueryTexture(tex, NULL, NULL, &rct.w, &rct.h);
 
@@ -422,28 +2098,109 @@ static void _pico_output_draw_image_tex (Pico_Pos pos, SDL_Texture* tex) {
     rct.x = X(pos.x, rct.w);
     rct.y = Y(pos.y, rct.h);
 
-    SDL_RenderCopyEx(REN, tex, &crp, &rct, S.angle, NULL, (SDL_RendererFlip)S.flip);
-    _pico_output_present(0);
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_COPY, .color=S.color.draw,
+        .copy = { tex, NULL, own, crp, rct, S.angle, S.flip }
+    });
 }
 
-static void _pico_output_draw_image_cache (Pico_Pos pos, const char* path, int cache) {
+typedef struct {
+    const char* path;
+    SDL_Texture* tex;
+} Pico_Load;
+
+// Decoded pixels go straight to the texture.
+static SDL_Texture* _pico_image_rgba (const void* pixels, int w, int h) {
+    SDL_Texture* tex = SDL_CreateTexture (
+        REN, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, w, h
+    );
+    if (tex != NULL) {
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        SDL_UpdateTexture(tex, NULL, pixels, 4*w);
+    }
+    return tex;
+}
+
+// Each image has its own single-entry archive in the cache directory.
+// The entry name is the full key, so a stale or colliding file is a miss.
+static SDL_Texture* _pico_image_cached (const char* path) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return IMG_LoadTexture(REN, path);  // reports the error
+    }
+    char key[1024];
+    snprintf(key, sizeof(key), "%s:%lld:%lld",
+             path, (long long)st.st_mtime, (long long)st.st_size);
+    Uint64 h = 14695981039346656037ULL;     // FNV-1a
+    for (const char* c=key; *c; c++) {
+        h = (h ^ (Uint8)*c) * 1099511628211ULL;
+    }
+    char file[1024];
+    snprintf(file, sizeof(file), "%s/%016llx.pak", _pico_cache, (unsigned long long)h);
+
     SDL_Texture* tex = NULL;
-    if (cache) {
-        tex = pico_hash_get(_pico_hash, path);
-        if (tex == NULL) {
-            tex = IMG_LoadTexture(REN, path);
-            pico_hash_add(_pico_hash, path, tex);
+    pico_pak* pak = pico_pak_open(file);
+    const pico_pak_ent* e = (pak == NULL) ? NULL : pico_pak_get(pak, key);
+    // a partly written file is a miss, and gets rewritten
+    if (e!=NULL && e->type==PICO_PAK_RGBA && e->size==4*(Uint64)e->w*e->h) {
+        tex = _pico_image_rgba(pico_pak_data(pak,e), e->w, e->h);
+        _pico_stats.cache.hits++;
+    } else {
+        if (pak != NULL) {
+            pico_pak_close(pak);    // not mapped while rewritten
+            pak = NULL;
+        }
+        SDL_Surface* img = IMG_Load(path);
+        SDL_Surface* sfc = (img == NULL) ? NULL :
+            SDL_ConvertSurfaceFormat(img, SDL_PIXELFORMAT_RGBA8888, 0);
+        if (sfc != NULL) {
+            // 32-bit rows are never padded, so pixels are contiguous
+            pico_pak_ent ent = { 0, PICO_PAK_RGBA, 0, 4*sfc->w*sfc->h, sfc->w, sfc->h };
+            const char*  names[] = { key };
+            const void*  datas[] = { sfc->pixels };
+            pico_pak_write(file, 1, names, &ent, datas);  // best effort
+            tex = _pico_image_rgba(sfc->pixels, sfc->w, sfc->h);
+            SDL_FreeSurface(sfc);
         }
+        SDL_FreeSurface(img);
+        _pico_stats.cache.misses++;
+    }
+    if (pak != NULL) {
+        pico_pak_close(pak);
+    }
+    return tex;
+}
+
+static void _pico_image_load (void* arg) {
+    Pico_Load* ld = arg;
+    const pico_pak_ent* e = _pico_pak_get(ld->path);
+    if (e != NULL) {
+        ld->tex = (e->type == PICO_PAK_RAW) ?
+            IMG_LoadTexture_RW(REN, _pico_pak_rw(e), 1) :
+            _pico_image_rgba(pico_pak_data(_pico_pak,e), e->w, e->h);
+    } else if (_pico_cache != NULL) {
+        ld->tex = _pico_image_cached(ld->path);
     } else {
-        tex = IMG_LoadTexture(REN, path);
+        ld->tex = IMG_LoadTexture(REN, ld->path);
     }
-    pico_assert(tex != NULL);
-
-    _pico_output_draw_image_tex(pos, tex);
+}
 
-    if (!cache) {
-        SDL_DestroyTexture(tex);
+static void _pico_output_draw_image_cache (Pico_Pos pos, const char* path, int cache) {
+    Pico_Load ld = { path, NULL };
+    if (cache) {
+        ld.tex = pico_hash_get(_pico_hash, path);
+        if (ld.tex == NULL) {
+            _pico_call(_pico_image_load, &ld);
+            pico_hash_add(_pico_hash, path, ld.tex);
+            _pico_watch_add(path, PICO_WATCH_IMAGE);
+        }
+    } else {
+        _pico_call(_pico_image_load, &ld);
     }
+    pico_assert(ld.tex != NULL);
+
+    // uncached textures are freed once drawn
+    _pico_output_draw_image_tex(pos, ld.tex, !cache);
 }
 
 void pico_output_draw_image (Pico_Pos pos, const char* path) {
@@ -451,23 +2208,37 @@ void pico_output_draw_image (Pico_Pos pos, const char* path) {
 }
 
 void pico_output_draw_line (Pico_Pos p1, Pico_Pos p2) {
-    SDL_RenderDrawLine(REN, X(p1.x,1),Y(p1.y,1), X(p2.x,1),Y(p2.y,1));
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_LINE, .color=S.color.draw,
+        .line = { {X(p1.x,1),Y(p1.y,1)}, {X(p2.x,1),Y(p2.y,1)} }
+    });
+}
+
+void pico_output_draw_list (Pico_Pos pos, const char* name) {
+    Pico_List* l = pico_hash_get(_pico_lists.hash, name);
+    assert(l != NULL && "list was not recorded");
+    assert(l != _pico_lists.rec && "list is being recorded");
+    _pico_cmd_run((Pico_Cmd) { .op=PICO_CMD_LIST, .list={l,pos} });
     _pico_output_present(0);
 }
 
 void pico_output_draw_pixel (Pico_Pos pos) {
-    SDL_RenderDrawPoint(REN, X(pos.x,1), Y(pos.y,1) );
-    _pico_output_present(0);
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_PIXEL, .color=S.color.draw,
+        .pixel = { X(pos.x,1), Y(pos.y,1) }
+    });
 }
 
 void pico_output_draw_pixels (const Pico_Pos* poss, int count) {
-    Pico_Pos vec[count];
+    Pico_Pos* vec = _pico_arena_alloc(&_pico_frame.app, count*sizeof(Pico_Pos));
     for (int i=0; i<count; i++) {
         vec[i].x = X(poss[i].x,1);
         vec[i].y = Y(poss[i].y,1);
     }
-    SDL_RenderDrawPoints(REN, vec, count);
-    _pico_output_present(0);
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_PIXELS, .color=S.color.draw,
+        .pixels = { vec, 0, count }
+    });
 }
 
 void pico_output_draw_rect (Pico_Rect rect) {
@@ -476,15 +2247,10 @@ void pico_output_draw_rect (Pico_Rect rect) {
         Y(rect.y, rect.h),
         rect.w, rect.h
     };
-    switch (S.style) {
-        case PICO_FILL:
-            SDL_RenderFillRect(REN, &out);
-            break;
-        case PICO_STROKE:
-            SDL_RenderDrawRect(REN, &out);
-            break;
-    }
-    _pico_output_present(0);
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_RECT, .color=S.color.draw,
+        .rect = { S.style, out }
+    });
 }
 
 void pico_output_draw_oval (Pico_Rect rect) {
@@ -493,126 +2259,570 @@ void pico_output_draw_oval (Pico_Rect rect) {
         Y(rect.y, rect.h),
         rect.w, rect.h
     };
-    switch (S.style) {
-        case PICO_FILL:
-            filledEllipseRGBA (
-                REN,
-                out.x+out.w/2, out.y+out.h/2, out.w/2, out.h/2,
-                S.color.draw.r, S.color.draw.g, S.color.draw.b, S.color.draw.a
-            );
-            break;
-        case PICO_STROKE:
-            ellipseRGBA (
-                REN,
-                out.x+out.w/2, out.y+out.h/2, out.w/2, out.h/2,
-                S.color.draw.r, S.color.draw.g, S.color.draw.b, S.color.draw.a
-            );
-            break;
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_OVAL, .color=S.color.draw,
+        .rect = { S.style, out }
+    });
+}
+
+// Particles are kept in one array per field, so that the update loops
+// over contiguous floats, which the compiler vectorizes. Dead particles
+// are replaced by the last one, so the arrays stay dense.
+struct Pico_Particles {
+    int n, max;
+    float* x;
+    float* y;
+    float* vx;
+    float* vy;
+    float* life;        // seconds left
+    float* ttl;         // seconds at emission, for the fade
+    Pico_Color* color;
+};
+
+Pico_Particles* pico_particles_create (int max) {
+    Pico_Particles* ps = malloc(sizeof(Pico_Particles));
+    float* f = malloc(6*max*sizeof(float));
+    Pico_Color* c = malloc(max*sizeof(Pico_Color));
+    assert(ps!=NULL && f!=NULL && c!=NULL && "cannot allocate particles");
+    *ps = (Pico_Particles) {
+        0, max, f, f+max, f+2*max, f+3*max, f+4*max, f+5*max, c
+    };
+    return ps;
+}
+
+void pico_particles_destroy (Pico_Particles* ps) {
+    free(ps->x);
+    free(ps->color);
+    free(ps);
+}
+
+int pico_particles_count (Pico_Particles* ps) {
+    return ps->n;
+}
+
+void pico_particles_emit (Pico_Particles* ps, int n, Pico_Pos pos, float speed, float life) {
+    assert(life>0 && "invalid particle life");
+    for (int k=0; k<n && ps->n<ps->max; k++) {
+        int i = ps->n++;
+        float a = 2 * M_PI * rand() / RAND_MAX;
+        float v = speed * rand() / RAND_MAX;
+        ps->x[i]  = pos.x;
+        ps->y[i]  = pos.y;
+        ps->vx[i] = v * SDL_cosf(a);
+        ps->vy[i] = v * SDL_sinf(a);
+        ps->life[i] = ps->ttl[i] = life;
+        ps->color[i] = S.color.draw;
+    }
+}
+
+void pico_particles_update (Pico_Particles* ps, float dt, float ax, float ay) {
+    float* restrict x  = ps->x;
+    float* restrict y  = ps->y;
+    float* restrict vx = ps->vx;
+    float* restrict vy = ps->vy;
+    float* restrict lf = ps->life;
+    int n = ps->n;
+    for (int i=0; i<n; i++) {
+        vx[i] += ax * dt;
+        vy[i] += ay * dt;
+        x[i]  += vx[i] * dt;
+        y[i]  += vy[i] * dt;
+        lf[i] -= dt;
+    }
+    for (int i=0; i<n; ) {
+        if (lf[i] > 0) {
+            i++;
+            continue;
+        }
+        n--;
+        x[i]  = x[n];
+        y[i]  = y[n];
+        vx[i] = vx[n];
+        vy[i] = vy[n];
+        lf[i] = lf[n];
+        ps->ttl[i]   = ps->ttl[n];
+        ps->color[i] = ps->color[n];
+    }
+    ps->n = n;
+}
+
+// All particles go in a single geometry command, as one-pixel quads that
+// fade out with their life.
+void pico_output_draw_particles (Pico_Particles* ps) {
+    int n = ps->n;
+    if (n == 0) {
+        return;
+    }
+    float* xy = _pico_arena_alloc(&_pico_frame.app, 8*n*sizeof(float));
+    SDL_Color* col = _pico_arena_alloc(&_pico_frame.app, 4*n*sizeof(SDL_Color));
+    float dx = X(0,1);
+    float dy = Y(0,1);
+    float x0=ps->x[0], y0=ps->y[0], x1=x0, y1=y0;
+    for (int i=0; i<n; i++) {
+        float x = ps->x[i] + dx;
+        float y = ps->y[i] + dy;
+        float* q = &xy[8*i];
+        q[0]=x;   q[1]=y;
+        q[2]=x+1; q[3]=y;
+        q[4]=x;   q[5]=y+1;
+        q[6]=x+1; q[7]=y+1;
+        SDL_Color c = ps->color[i];
+        c.a = c.a * ps->life[i] / ps->ttl[i];
+        col[4*i+0] = col[4*i+1] = col[4*i+2] = col[4*i+3] = c;
+        x0 = (ps->x[i] < x0) ? ps->x[i] : x0;
+        y0 = (ps->y[i] < y0) ? ps->y[i] : y0;
+        x1 = (ps->x[i] > x1) ? ps->x[i] : x1;
+        y1 = (ps->y[i] > y1) ? ps->y[i] : y1;
+    }
+    // quads span [x,x+1), so both edges are rounded outwards
+    int rx = SDL_floorf(x0+dx);
+    int ry = SDL_floorf(y0+dy);
+    Pico_Rect r = {
+        rx, ry,
+        (int)SDL_ceilf(x1+dx+1) - rx, (int)SDL_ceilf(y1+dy+1) - ry
+    };
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_GEOM, .geom = { xy, col, n, 0, r }
+    });
+}
+
+void pico_output_draw_text (Pico_Pos pos, const char* text) {
+    if (!text || text[0] == '\0') return;
+
+    _pico_font();
+    SDL_Surface* sfc = TTF_RenderText_Blended(S.font.ttf, text, S.color.draw);
+    pico_assert(sfc != NULL);
+
+    Pico_Rect rct;
+
+    // SCALE
+    rct.w = sfc->w; // * GRAPHICS_SET_SCALE_W;
+    rct.h = sfc->h; // * GRAPHICS_SET_SCALE_H;
+
+    // ANCHOR
+    rct.x = X(pos.x, rct.w);
+    rct.y = Y(pos.y, rct.h);
+
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_COPY, .color=S.color.draw,
+        .copy = { NULL, sfc, 1, {0,0,0,0}, rct, S.angle, S.flip }
+    });
+}
+
+// Renders the grid lines once into a physical-size texture, so that each
+// present only composites it with a single copy.
+static void _pico_grid_create (void) {
+    Pico_Dim phy = PHY;
+    GRID = SDL_CreateTexture (
+        REN, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        phy.x, phy.y
+    );
+    pico_assert(GRID != NULL);
+    SDL_SetTextureBlendMode(GRID, SDL_BLENDMODE_BLEND);
+
+    SDL_SetRenderTarget(REN, GRID);
+    _pico_color((Pico_Color) {0x00,0x00,0x00,0x00});
+    SDL_RenderClear(REN);
+
+    // lines keep their own alpha and are only blended when composited
+    _pico_color_blend((Pico_Color) {0x77,0x77,0x77,0x77}, SDL_BLENDMODE_NONE);
+    for (int i=0; i<=phy.x; i+=(phy.x/S.size.cur.x)) {
+        SDL_RenderDrawLine(REN, i, 0, i, phy.y);
+    }
+    for (int j=0; j<=phy.y; j+=(phy.y/S.size.cur.y)) {
+        SDL_RenderDrawLine(REN, 0, j, phy.x, j);
+    }
+    SDL_SetRenderTarget(REN, NULL);
+}
+
+static void _pico_grid_destroy (void) {
+    if (GRID != NULL) {
+        SDL_DestroyTexture(GRID);
+        GRID = NULL;
+    }
+}
+
+static void show_grid (void) {
+    if (!S.grid) return;
+    if (GRID == NULL) {
+        _pico_grid_create();
+    }
+    SDL_RenderCopy(REN, GRID, NULL, NULL);
+}
+
+// Converts a logical rectangle to window pixels.
+static Pico_Rect _pico_phy_rect (Pico_Rect r) {
+    int x1, y1, x2, y2;
+    SDL_RenderLogicalToWindow(REN, r.x, r.y, &x1, &y1);
+    SDL_RenderLogicalToWindow(REN, r.x+r.w, r.y+r.h, &x2, &y2);
+    return (Pico_Rect) { x1, y1, x2-x1, y2-y1 };
+}
+
+// Copies the part of each visible layer that falls in area (in logical
+// coordinates) to the window, from the lowest to the highest z.
+static void _pico_compose (Pico_Rect view, Pico_Rect area) {
+    int ord[PICO_LAYERS];
+    for (int i=0; i<_pico_layers.n; i++) {
+        int j = i;
+        while (j>0 && _pico_layers.vec[ord[j-1]].z > _pico_layers.vec[i].z) {
+            ord[j] = ord[j-1];
+            j--;
+        }
+        ord[j] = i;
+    }
+
+    int base = 1;
+    for (int k=0; k<_pico_layers.n; k++) {
+        Pico_Layer* l = &_pico_layers.vec[ord[k]];
+        if (!l->show) {
+            continue;
+        }
+
+        // an opaque main screen at the bottom is copied without blending
+        int opaque = (base && l->tex==TEX && l->alpha==0xFF);
+        base = 0;
+
+        Pico_Rect rct = { -l->scroll.x, -l->scroll.y, S.size.org.x, S.size.org.y };
+        Pico_Rect r;
+        if (!SDL_IntersectRect(&rct, &area, &r)) {
+            continue;
+        }
+        Pico_Rect src = { r.x+l->scroll.x, r.y+l->scroll.y, r.w, r.h };
+        Pico_Rect dst = { r.x-view.x, r.y-view.y, r.w, r.h };
+        SDL_SetTextureBlendMode(l->tex, opaque ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(l->tex, l->alpha);
+        SDL_RenderCopy(REN, l->tex, &src, &dst);
     }
-    _pico_output_present(0);
 }
 
-void pico_output_draw_text (Pico_Pos pos, const char* text) {
-    if (!text || text[0] == '\0') return;
+// Software rendering only: recomposes the dirty region and pushes only its
+// pixels to the window surface, skipping the full-window copy.
+static void _pico_output_present_dirty (Pico_Rect view) {
+    Pico_Rect r;
+    if (!SDL_IntersectRect(&_pico_dirty.rect, &view, &r)) {
+        _pico_stats.copy.pixels = 0;
+        return;
+    }
+    Pico_Rect dst = { r.x-view.x, r.y-view.y, r.w, r.h };
+    SDL_RenderSetClipRect(REN, &dst);
+    _pico_color_blend((Pico_Color) {0x77,0x77,0x77,0x77}, SDL_BLENDMODE_NONE);
+    SDL_RenderFillRect(REN, &dst);
+    _pico_compose(view, r);
+    show_grid();
+    SDL_RenderSetClipRect(REN, NULL);
+    SDL_RenderFlush(REN);
 
-    uint8_t r, g, b, a;
-    SDL_GetRenderDrawColor(REN, &r,&g,&b,&a);
-    pico_assert(S.font.ttf != NULL);
-    SDL_Surface* sfc = TTF_RenderText_Blended(S.font.ttf, text,
-                                              (Pico_Color){r,g,b,a});
-    pico_assert(sfc != NULL);
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(REN, sfc);
-    pico_assert(tex != NULL);
+    Pico_Dim phy = PHY;
+    Pico_Rect win = { 0, 0, phy.x, phy.y };
+    Pico_Rect out = _pico_phy_rect(dst);
+    out = (Pico_Rect) { out.x-1, out.y-1, out.w+2, out.h+2 };
+    if (SDL_IntersectRect(&out, &win, &out)) {
+        SDL_UpdateWindowSurfaceRects(WIN, &out, 1);
+        _pico_stats.copy.pixels = out.w * out.h;
+    } else {
+        _pico_stats.copy.pixels = 0;
+    }
+}
 
-    Pico_Rect rct;
+// Composes the layers to the window (render side).
+static void _pico_present (void) {
+    _pico_batch_flush();
+    SDL_SetRenderTarget(REN, NULL);
 
-    // SCALE
-    rct.w = sfc->w; // * GRAPHICS_SET_SCALE_W;
-    rct.h = sfc->h; // * GRAPHICS_SET_SCALE_H;
+    // zoom and pan only select which part of the layers is copied
+    Pico_Rect view = _pico_view();
 
-    // ANCHOR
-    rct.x = X(pos.x, rct.w);
-    rct.y = Y(pos.y, rct.h);
+    if (_pico_dirty.soft && !_pico_dirty.all) {
+        _pico_output_present_dirty(view);
+    } else {
+        _pico_color((Pico_Color) {0x77,0x77,0x77,0x77});
+        SDL_RenderClear(REN);
+        _pico_compose(view, view);
+        show_grid();
+        SDL_RenderPresent(REN);
+        Pico_Dim phy = PHY;
+        _pico_stats.copy.pixels = phy.x * phy.y;
+    }
+    _pico_stats.frames++;
+    _pico_stats.copy.total += _pico_stats.copy.pixels;
+    _pico_dirty.all = 0;
+    _pico_dirty.rect = (Pico_Rect) { 0, 0, 0, 0 };
+    _pico_arena_reset(&_pico_frame.ren);
+    SDL_SetRenderTarget(REN, _pico_layers.vec[S.layer].tex);
+}
 
-    SDL_RenderCopyEx(REN, tex, NULL, &rct, S.angle, NULL, (SDL_RendererFlip)S.flip);
-    _pico_output_present(0);
+// With the render thread, presenting ends the frame being recorded, which is
+// then rendered while the caller goes on with the next one.
+static void _pico_output_present (int force) {
+    if (S.expert && !force) return;
+    _pico_log_flush();
+    _pico_watch_poll();
+    if (_pico_render_side()) {
+        _pico_present();
+    } else {
+        _pico_list_push (
+            &_pico_thread.buf[_pico_thread.cur],
+            (Pico_Cmd) { .op=PICO_CMD_PRESENT }
+        );
+        _pico_thread_flush(0);
+    }
+    _pico_arena_reset(&_pico_frame.app);
+}
 
-    SDL_DestroyTexture(tex);
-    SDL_FreeSurface(sfc);
+void pico_output_present (void) {
+    _pico_output_present(1);
 }
 
-static void show_grid (void) {
-    if (!S.grid) return;
+// Called from the audio thread, which cannot call back into the mixer.
+static void _pico_music_done (void) {
+    SDL_Event e = { .type = _pico_music.evt };
+    SDL_PushEvent(&e);
+}
 
-    SDL_SetRenderDrawColor(REN, 0x77,0x77,0x77,0x77);
+static void _pico_music_play (void) {
+    if (_pico_music.fade > 0) {
+        Mix_FadeInMusic(_pico_music.cur, _pico_music.loops, _pico_music.fade);
+    } else {
+        Mix_PlayMusic(_pico_music.cur, _pico_music.loops);
+    }
+}
 
-    Pico_Dim phy = PHY;
-    SDL_RenderSetLogicalSize(REN, phy.x, phy.y);
-    for (int i=0; i<=phy.x; i+=(phy.x/S.size.cur.x)) {
-        SDL_RenderDrawLine(REN, i, 0, i, phy.y);
+// Releases the music that stopped and starts the next one, if any.
+static void _pico_music_next (void) {
+    if (Mix_PlayingMusic()) {
+        return;
     }
-    for (int j=0; j<=phy.y; j+=(phy.y/S.size.cur.y)) {
-        SDL_RenderDrawLine(REN, 0, j, phy.x, j);
+    Mix_FreeMusic(_pico_music.cur);
+    _pico_music.cur = _pico_music.next;
+    _pico_music.next = NULL;
+    if (_pico_music.cur != NULL) {
+        _pico_music_play();
     }
-    SDL_RenderSetLogicalSize(REN, S.size.cur.x, S.size.cur.y);
+}
 
-    SDL_SetRenderDrawColor (REN,
-        S.color.draw.r,
-        S.color.draw.g,
-        S.color.draw.b,
-        S.color.draw.a
-    );
+void pico_output_music (const char* path) {
+    pico_output_music_ext(path, -1, 0);
 }
 
-static void _pico_output_present (int force) {
-    if (S.expert && !force) return;
-    SDL_SetRenderTarget(REN, NULL);
-    SDL_SetRenderDrawColor(REN, 0x77,0x77,0x77,0x77);
-    SDL_RenderClear(REN);
-    SDL_RenderCopy(REN, TEX, NULL, NULL);
-    show_grid();
-    SDL_RenderPresent(REN);
-    SDL_SetRenderDrawColor (REN,
-        S.color.draw.r,
-        S.color.draw.g,
-        S.color.draw.b,
-        S.color.draw.a
-    );
-    SDL_SetRenderTarget(REN, TEX);
+void pico_output_music_ext (const char* path, int loops, int fade) {
+    _pico_audio_open();
+    Mix_Music* mus = NULL;
+    if (path != NULL) {
+        const pico_pak_ent* e = _pico_pak_get(path);
+        mus = (e == NULL) ? Mix_LoadMUS(path) : Mix_LoadMUS_RW(_pico_pak_rw(e), 1);
+        pico_assert(mus != NULL);
+    }
+    Mix_FreeMusic(_pico_music.next);
+    _pico_music.next = NULL;
+    _pico_music.loops = loops;
+    _pico_music.fade = fade;
+
+    if (fade>0 && Mix_PlayingMusic()) {
+        _pico_music.next = mus;
+        Mix_FadeOutMusic(fade);
+    } else {
+        Mix_HaltMusic();
+        Mix_FreeMusic(_pico_music.cur);
+        _pico_music.cur = mus;
+        if (mus != NULL) {
+            _pico_music_play();
+        }
+    }
 }
 
-void pico_output_present (void) {
-    _pico_output_present(1);
+static Mix_Chunk* _pico_sound_load (const char* path) {
+    const pico_pak_ent* e = _pico_pak_get(path);
+    return (e == NULL) ? Mix_LoadWAV(path) : Mix_LoadWAV_RW(_pico_pak_rw(e), 1);
 }
 
 static void _pico_output_sound_cache (const char* path, int cache) {
+    _pico_audio_open();
     Mix_Chunk* mix = NULL;
 
     if (cache) {
         mix = pico_hash_get(_pico_hash, path);
         if (mix == NULL) {
-            mix = Mix_LoadWAV(path);
+            mix = _pico_sound_load(path);
             pico_hash_add(_pico_hash, path, mix);
+            _pico_watch_add(path, PICO_WATCH_SOUND);
         }
     } else {
-        mix = Mix_LoadWAV(path);
+        mix = _pico_sound_load(path);
     }
     pico_assert(mix != NULL);
 
-    Mix_PlayChannel(-1, mix, 0);
+    // steals the oldest channel when all are busy
+    if (Mix_PlayChannel(-1, mix, 0) == -1) {
+        Mix_PlayChannel(Mix_GroupOldest(-1), mix, 0);
+    }
 
     if (!cache) {
         Mix_FreeChunk(mix);
     }
 }
 
+// WATCH
+
+static void _pico_watch_add (const char* path, int kind) {
+#ifdef __linux__
+    if (_pico_watch.fd<0 || _pico_pak_get(path)!=NULL) {
+        return;
+    }
+    const char* sl = strrchr(path, '/');
+    int len = (sl == NULL) ? 0 : sl-path+1;
+    char* pre = strndup(path, len);
+    int wd = inotify_add_watch (
+        _pico_watch.fd, (len == 0) ? "." : pre, IN_CLOSE_WRITE | IN_MOVED_TO
+    );
+    free(pre);
+    if (wd < 0) {
+        return;
+    }
+
+    // the same directory gives the same descriptor, however spelled
+    int d = 0;
+    while (d<_pico_watch.n && _pico_watch.dirs[d].wd!=wd) {
+        d++;
+    }
+    if (d == _pico_watch.n) {
+        assert(_pico_watch.n < PICO_WATCH && "too many watched directories");
+        _pico_watch.dirs[_pico_watch.n++] = (typeof(_pico_watch.dirs[0])) { wd, -1 };
+    }
+
+    if (_pico_watch.m == _pico_watch.max) {
+        _pico_watch.max = MAX(16, 2*_pico_watch.max);
+        _pico_watch.files = realloc (
+            _pico_watch.files, _pico_watch.max*sizeof(*_pico_watch.files)
+        );
+        assert(_pico_watch.files != NULL && "cannot watch file");
+    }
+    char* dup = strdup(path);
+    assert(dup != NULL && "cannot watch file");
+    _pico_watch.files[_pico_watch.m] = (typeof(*_pico_watch.files)) {
+        _pico_watch.dirs[d].head, kind, dup, dup+len
+    };
+    _pico_watch.dirs[d].head = _pico_watch.m++;
+#else
+    (void) path;
+    (void) kind;
+#endif
+}
+
+// Updates the texture in place, or replaces it when the size changed.
+// Recorded lists then draw the new texture, so the old one is released
+// (render side).
+static void _pico_image_reload (void* arg) {
+    Pico_Load* ld = arg;
+    SDL_Surface* img = IMG_Load(ld->path);
+    if (img == NULL) {
+        return;     // possibly still being written, keeps the old contents
+    }
+    Uint32 fmt;
+    int w, h;
+    SDL_QueryTexture(ld->tex, &fmt, NULL, &w, &h);
+    if (img->w==w && img->h==h) {
+        SDL_Surface* sfc = SDL_ConvertSurfaceFormat(img, fmt, 0);
+        if (sfc != NULL) {
+            SDL_UpdateTexture(ld->tex, NULL, sfc->pixels, sfc->pitch);
+            SDL_FreeSurface(sfc);
+        }
+    } else {
+        SDL_Texture* tex = SDL_CreateTextureFromSurface(REN, img);
+        if (tex != NULL) {
+            for (Pico_List* l=_pico_lists.all; l!=NULL; l=l->next) {
+                for (int i=0; i<l->n; i++) {
+                    Pico_Cmd* c = &l->cmds[i];
+                    if (c->op==PICO_CMD_COPY && c->copy.tex==ld->tex) {
+                        c->copy.tex = tex;
+                    }
+                }
+            }
+            SDL_DestroyTexture(ld->tex);
+            ld->tex = tex;
+        }
+    }
+    SDL_FreeSurface(img);
+}
+
+// Swaps the samples into the cached chunk, which stays the same handle.
+static void _pico_sound_reload (const char* path) {
+    Mix_Chunk* old = pico_hash_get(_pico_hash, path);
+    Mix_Chunk* mix = Mix_LoadWAV(path);
+    if (mix == NULL) {
+        return;
+    }
+    for (int i=0; i<PICO_CHANNELS; i++) {
+        if (Mix_GetChunk(i) == old) {
+            Mix_HaltChannel(i);
+        }
+    }
+    Mix_Chunk tmp = *old;
+    old->allocated = mix->allocated;
+    old->abuf = mix->abuf;
+    old->alen = mix->alen;
+    mix->allocated = tmp.allocated;
+    mix->abuf = tmp.abuf;
+    mix->alen = tmp.alen;
+    Mix_FreeChunk(mix);
+}
+
+static void _pico_watch_poll (void) {
+#ifdef __linux__
+    if (_pico_watch.fd < 0) {
+        return;
+    }
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t len;
+    while ((len = read(_pico_watch.fd, buf, sizeof(buf))) > 0) {
+        const struct inotify_event* ev;
+        for (char* p=buf; p<buf+len; p+=sizeof(*ev)+ev->len) {
+            ev = (const struct inotify_event*) p;
+            int d = 0;
+            while (d<_pico_watch.n && _pico_watch.dirs[d].wd!=ev->wd) {
+                d++;
+            }
+            if (d==_pico_watch.n || ev->len==0) {
+                continue;
+            }
+            for (int i=_pico_watch.dirs[d].head; i!=-1; i=_pico_watch.files[i].next) {
+                const char* path = _pico_watch.files[i].path;
+                if (strcmp(_pico_watch.files[i].name, ev->name) != 0) {
+                    continue;
+                }
+                switch (_pico_watch.files[i].kind) {
+                    case PICO_WATCH_IMAGE: {
+                        Pico_Load ld = { path, pico_hash_get(_pico_hash, path) };
+                        _pico_call(_pico_image_reload, &ld);
+                        pico_hash_add(_pico_hash, path, ld.tex);
+                        break;
+                    }
+                    case PICO_WATCH_SOUND:
+                        _pico_sound_reload(path);
+                        break;
+                }
+            }
+        }
+    }
+#endif
+}
+
 const char* pico_output_screenshot (const char* path) {
     return pico_output_screenshot_ext(
         path,
-        (Pico_Rect){0,0,S.size.cur.x,S.size.cur.y}
+        (Pico_Rect){0,0,S.size.org.x,S.size.org.y}
     );
 }
 
+typedef struct {
+    Pico_Rect r;
+    void* buf;
+} Pico_Read;
+
+static void _pico_read_pixels (void* arg) {
+    Pico_Read* rd = arg;
+    SDL_RenderReadPixels(REN, &rd->r, SDL_PIXELFORMAT_RGBA8888, rd->buf, 4*rd->r.w);
+}
+
 const char* pico_output_screenshot_ext (const char* path, Pico_Rect r) {
     const char* ret;
     if (path != NULL) {
@@ -625,12 +2835,11 @@ const char* pico_output_screenshot_ext (const char* path, Pico_Rect r) {
         ret = _path_;
     }
 
-    void* buf = malloc(4*r.w*r.h);
-    SDL_RenderReadPixels(REN, &r, SDL_PIXELFORMAT_RGBA8888, buf, 4*r.w);
+    void* buf = _pico_arena_alloc(&_pico_frame.app, 4*r.w*r.h);
+    _pico_call(_pico_read_pixels, &(Pico_Read) { r, buf });
     SDL_Surface *sfc = SDL_CreateRGBSurfaceFrom(buf, r.w, r.h, 32, 4*r.w,
                                                 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
     assert(IMG_SavePNG(sfc,ret)==0 && "saving screenshot");
-    free(buf);
     SDL_FreeSurface(sfc);
     return ret;
 }
@@ -640,6 +2849,7 @@ void pico_output_sound (const char* path) {
 }
 
 static void _pico_output_write_aux (const char* text, int isln) {
+    _pico_font();
     if (strlen(text) == 0) {
         if (isln) {
             S.cursor.cur.x = S.cursor.x;
@@ -648,30 +2858,26 @@ static void _pico_output_write_aux (const char* text, int isln) {
         return;
     }
 
-    pico_assert(S.font.ttf != NULL);
     SDL_Surface* sfc = TTF_RenderText_Blended (
         S.font.ttf, text,
         (Pico_Color) { S.color.draw.r, S.color.draw.g,
                        S.color.draw.b, S.color.draw.a }
     );
     pico_assert(sfc != NULL);
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(REN, sfc);
-    pico_assert(tex != NULL);
 
     int w, h;
     TTF_SizeText(S.font.ttf, text, &w,&h);
     Pico_Rect rct = { X(S.cursor.cur.x,0),Y(S.cursor.cur.y,0), w,h };
-    SDL_RenderCopy(REN, tex, NULL, &rct);
-    _pico_output_present(0);
+    _pico_output_cmd ((Pico_Cmd) {
+        .op=PICO_CMD_COPY, .color=S.color.draw,
+        .copy = { NULL, sfc, 1, {0,0,0,0}, rct, 0, PICO_NOFLIP }
+    });
 
     S.cursor.cur.x += w;
     if (isln) {
         S.cursor.cur.x = S.cursor.x;
         S.cursor.cur.y += S.font.h;
     }
-
-    SDL_DestroyTexture(tex);
-    SDL_FreeSurface(sfc);
 }
 
 void pico_output_write (const char* text) {
@@ -685,12 +2891,41 @@ void pico_output_writeln (const char* text) {
 
 // STATE
 
+// STACK
+
+static struct {
+    int n;
+    typeof(S) vec[PICO_STACK];
+} _pico_stack;
+
+void pico_push (void) {
+    assert(_pico_stack.n < PICO_STACK && "state stack is full");
+    _pico_stack.vec[_pico_stack.n++] = S;
+}
+
+void pico_pop (void) {
+    assert(_pico_stack.n > 0 && "state stack is empty");
+    typeof(S)* old = &_pico_stack.vec[--_pico_stack.n];
+    S.anchor = old->anchor;
+    S.color  = old->color;
+    S.cursor = old->cursor;
+    S.image  = old->image;
+    S.scroll = old->scroll;
+    S.style  = old->style;
+    S.flip   = old->flip;
+    S.angle  = old->angle;
+}
+
 // GET
 
 Pico_Anchor pico_get_anchor (void) {
     return S.anchor;
 }
 
+Pico_Camera pico_get_camera (void) {
+    return _pico_camera;
+}
+
 Pico_Color pico_get_color_clear (void) {
     return S.color.clear;
 }
@@ -703,6 +2938,10 @@ Pico_Pos pico_get_cursor (void) {
     return S.cursor.cur;
 }
 
+int pico_get_event (int type) {
+    return SDL_EventState(type, SDL_QUERY) == SDL_ENABLE;
+}
+
 int pico_get_expert (void) {
     return S.expert;
 }
@@ -712,6 +2951,7 @@ PICO_FLIP pico_get_flip () {
 }
 
 const char* pico_get_font (void) {
+    _pico_font();
     return TTF_FontFaceFamilyName(S.font.ttf);
 }
 
@@ -719,15 +2959,76 @@ int pico_get_grid (void) {
     return S.grid;
 }
 
+int pico_get_key (int key) {
+    return _pico_input_bit(_pico_input.keys.now, key);
+}
+
+int pico_get_key_pressed (int key) {
+    return _pico_input_bit(_pico_input.keys.now, key) &&
+          !_pico_input_bit(_pico_input.keys.old, key);
+}
+
+int pico_get_key_released (int key) {
+    return !_pico_input_bit(_pico_input.keys.now, key) &&
+            _pico_input_bit(_pico_input.keys.old, key);
+}
+
+const char* pico_get_layer (void) {
+    return _pico_layers.vec[S.layer].name;
+}
+
+int pico_get_latency (void) {
+    _pico_audio_open();
+    return _pico_audio.buf * 1000 / _pico_audio.freq;
+}
+
+Pico_Pos pico_get_mouse (void) {
+    return _pico_input.mouse;
+}
+
+int pico_get_mouse_button (int button) {
+    return (_pico_input.buttons.now & SDL_BUTTON(button)) != 0;
+}
+
+int pico_get_mouse_pressed (int button) {
+    return  (_pico_input.buttons.now & SDL_BUTTON(button)) &&
+           !(_pico_input.buttons.old & SDL_BUTTON(button));
+}
+
+int pico_get_mouse_released (int button) {
+    return !(_pico_input.buttons.now & SDL_BUTTON(button)) &&
+            (_pico_input.buttons.old & SDL_BUTTON(button));
+}
+
+int pico_get_music_pause (void) {
+    _pico_audio_open();
+    return Mix_PausedMusic();
+}
+
+int pico_get_music_volume (void) {
+    _pico_audio_open();
+    return (Mix_VolumeMusic(-1)*100 + MIX_MAX_VOLUME/2) / MIX_MAX_VOLUME;
+}
+
+const char* pico_get_record (void) {
+    return (_pico_lists.rec == NULL) ? NULL : _pico_lists.rec->name;
+}
+
 Pico_Rect pico_get_image_crop (void) {
     return S.image.crop;
 }
 
 Pico_Dim pico_get_image_size (const char* file) {
-    SDL_Texture* tex = IMG_LoadTexture(REN, file);
-    pico_assert(tex != NULL);
-    Pico_Dim size;
-    SDL_QueryTexture(tex, NULL, NULL, &size.x, &size.y);
+    const pico_pak_ent* e = _pico_pak_get(file);
+    if (e!=NULL && e->type==PICO_PAK_RGBA) {
+        return (Pico_Dim) { e->w, e->h };
+    }
+
+    // decoding does not need the renderer
+    SDL_Surface* sfc = (e == NULL) ? IMG_Load(file) : IMG_Load_RW(_pico_pak_rw(e), 1);
+    pico_assert(sfc != NULL);
+    Pico_Dim size = { sfc->w, sfc->h };
+    SDL_FreeSurface(sfc);
     return size;
 }
 
@@ -747,6 +3048,14 @@ int pico_get_show (void) {
     return SDL_GetWindowFlags(WIN) & SDL_WINDOW_SHOWN;
 }
 
+Pico_Stats pico_get_stats (void) {
+    _pico_sync();
+    Pico_Stats s = _pico_stats;
+    s.frame.size = _pico_frame.app.max;
+    s.frame.peak = _pico_frame.app.peak;
+    return s;
+}
+
 PICO_STYLE pico_get_style (void) {
     return S.style;
 }
@@ -756,6 +3065,7 @@ Pico_Dim pico_get_text_size (const char* text) {
         return (Pico_Dim){0, 0};
     }
 
+    _pico_font();
     SDL_Surface* sfc = TTF_RenderText_Blended(S.font.ttf, text,
                                               (Pico_Color){0,0,0,255});
     pico_assert(sfc != NULL);
@@ -765,6 +3075,10 @@ Pico_Dim pico_get_text_size (const char* text) {
 }
 
 Uint32 pico_get_ticks (void) {
+    if (_pico_log.fast) {
+        Uint64 ms = (_pico_now() - _pico_log.t0) * 1000 / SDL_GetPerformanceFrequency();
+        return _pico_log.ticks0 + ms;
+    }
     return SDL_GetTicks();
 }
 
@@ -772,24 +3086,35 @@ const char* pico_get_title (void) {
     return SDL_GetWindowTitle(WIN);
 }
 
+Pico_Dim pico_get_zoom (void) {
+    return S.view.zoom;
+}
+
 // SET
 
 void pico_set_anchor (Pico_Anchor anchor) {
     S.anchor = anchor;
 }
 
+void pico_set_archive (const char* path) {
+    assert(_pico_pak == NULL && "archive is already set");
+    _pico_pak = pico_pak_open(path);
+    assert(_pico_pak != NULL && "cannot open archive");
+}
+
+// Not recorded in lists, which take the camera at the time they are drawn.
+void pico_set_camera (Pico_Camera cam) {
+    assert(cam.zoom>0 && "invalid camera zoom");
+    _pico_camera = cam;
+    _pico_cmd_run((Pico_Cmd) { .op=PICO_CMD_CAMERA, .camera=cam });
+}
+
 void pico_set_color_clear (Pico_Color color) {
     S.color.clear = color;
 }
 
 void pico_set_color_draw  (Pico_Color color) {
     S.color.draw = color;
-    SDL_SetRenderDrawColor (REN,
-        S.color.draw.r,
-        S.color.draw.g,
-        S.color.draw.b,
-        S.color.draw.a
-    );
 }
 
 void pico_set_cursor (Pico_Pos pos) {
@@ -797,6 +3122,12 @@ void pico_set_cursor (Pico_Pos pos) {
     S.cursor.x   = pos.x;
 }
 
+void pico_set_event (int type, int on) {
+    assert(type!=SDL_ANY && type!=SDL_QUIT && type!=SDL_WINDOWEVENT &&
+           "event type is handled internally");
+    SDL_EventState(type, on ? SDL_ENABLE : SDL_IGNORE);
+}
+
 void pico_set_expert (int on) {
     S.expert = on;
 }
@@ -806,29 +3137,127 @@ void pico_set_flip (PICO_FLIP flip) {
 }
 
 void pico_set_font (const char* file, int h) {
-    if (file == NULL) {
-        static char _file[255];
-        strcpy(_file, __FILE__);
-        _file[strlen(_file) - strlen("pico.c") - 1] = '\0';
-        strcat(_file, "/../tiny.ttf");
-        file = _file;
-    }
     if (h == 0) {
         h = MAX(8, S.size.org.y/10);
     }
     S.font.h = h;
-    if (S.font.ttf != NULL) {
-        TTF_CloseFont(S.font.ttf);
+
+    // switching back to a font already opened does not parse it again
+    for (Pico_Font** p=&_pico_fonts.all; *p!=NULL; p=&(*p)->next) {
+        Pico_Font* f = *p;
+        int same = (file==NULL || f->file==NULL) ? (file==f->file) : !strcmp(file,f->file);
+        if (same && f->h==h) {
+            *p = f->next;
+            f->next = _pico_fonts.all;
+            _pico_fonts.all = f;
+            S.font.ttf = f->ttf;
+            return;
+        }
+    }
+
+    // closes the least recently used font (never the current one, which
+    // is always first)
+    if (_pico_fonts.n == PICO_FONTS) {
+        Pico_Font** p = &_pico_fonts.all;
+        while ((*p)->next != NULL) {
+            p = &(*p)->next;
+        }
+        TTF_CloseFont((*p)->ttf);
+        free((*p)->file);
+        free(*p);
+        *p = NULL;
+        _pico_fonts.n--;
+    }
+
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    int first = !TTF_WasInit();
+    if (first) {
+        pico_assert(0 == TTF_Init());
     }
-    S.font.ttf = TTF_OpenFont(file, S.font.h);
-    pico_assert(S.font.ttf != NULL);
+    TTF_Font* ttf;
+    if (file == NULL) {
+        ttf = TTF_OpenFontRW(SDL_RWFromConstMem(tiny_ttf, tiny_ttf_len), 1, h);
+    } else {
+        const pico_pak_ent* e = _pico_pak_get(file);
+        ttf = (e == NULL) ? TTF_OpenFont(file, h) : TTF_OpenFontRW(_pico_pak_rw(e), 1, h);
+    }
+    pico_assert(ttf != NULL);
+    if (first) {
+        _pico_stats.init.font = _pico_usecs(t0);
+    }
+
+    Pico_Font* f = malloc(sizeof(Pico_Font));
+    assert(f != NULL && "cannot open font");
+    *f = (Pico_Font) { (file == NULL) ? NULL : strdup(file), h, ttf, _pico_fonts.all };
+    _pico_fonts.all = f;
+    _pico_fonts.n++;
+    S.font.ttf = ttf;
 }
 
 void pico_set_grid (int on) {
+    _pico_sync();
     S.grid = on;
+    _pico_dirty_all();
+    _pico_output_present(0);
+}
+
+static void _pico_layer_set (void* i) {
+    S.layer = *(int*)i;
+    SDL_SetRenderTarget(REN, _pico_layers.vec[S.layer].tex);
+}
+
+void pico_set_layer (const char* name) {
+    int i = _pico_layer(name);
+    _pico_call(_pico_layer_set, &i);
+}
+
+void pico_set_layer_alpha (const char* name, Uint8 alpha) {
+    int i = _pico_layer(name);
+    _pico_sync();
+    _pico_layers.vec[i].alpha = alpha;
+    _pico_dirty_all();
+    _pico_output_present(0);
+}
+
+void pico_set_layer_scroll (const char* name, Pico_Pos pos) {
+    int i = _pico_layer(name);
+    _pico_sync();
+    _pico_layers.vec[i].scroll = pos;
+    _pico_dirty_all();
+    _pico_output_present(0);
+}
+
+void pico_set_layer_show (const char* name, int on) {
+    int i = _pico_layer(name);
+    _pico_sync();
+    _pico_layers.vec[i].show = on;
+    _pico_dirty_all();
+    _pico_output_present(0);
+}
+
+void pico_set_layer_z (const char* name, int z) {
+    int i = _pico_layer(name);
+    _pico_sync();
+    _pico_layers.vec[i].z = z;
+    _pico_dirty_all();
     _pico_output_present(0);
 }
 
+void pico_set_music_pause (int on) {
+    _pico_audio_open();
+    if (on) {
+        Mix_PauseMusic();
+    } else {
+        Mix_ResumeMusic();
+    }
+}
+
+void pico_set_music_volume (int vol) {
+    assert(0<=vol && vol<=100 && "invalid volume");
+    _pico_audio_open();
+    Mix_VolumeMusic(vol * MIX_MAX_VOLUME / 100);
+}
+
 void pico_set_image_crop (Pico_Rect crop) {
     S.image.crop = crop;
 }
@@ -837,6 +3266,25 @@ void pico_set_image_size (Pico_Dim size) {
     S.image.size = size;
 }
 
+void pico_set_record (const char* name) {
+    if (name == NULL) {
+        _pico_lists.rec = NULL;
+        return;
+    }
+    Pico_List* l = pico_hash_get(_pico_lists.hash, name);
+    if (l == NULL) {
+        l = calloc(1, sizeof(Pico_List));
+        assert(l != NULL && "cannot record list");
+        l->name = strdup(name);
+        l->next = _pico_lists.all;
+        _pico_lists.all = l;
+        pico_hash_add(_pico_lists.hash, name, l);
+    } else {
+        _pico_call(_pico_list_clear, l);
+    }
+    _pico_lists.rec = l;
+}
+
 void pico_set_rotate (float angle) {
     S.angle = angle;
 }
@@ -845,49 +3293,79 @@ void pico_set_scroll (Pico_Pos pos) {
     S.scroll = pos;
 }
 
-void _pico_set_size (Pico_Dim phy, Pico_Dim log) {
-    // physical
-    {
-        if (phy.x==PICO_SIZE_KEEP.x && phy.y==PICO_SIZE_KEEP.y) {
-            // keep
-        } else if (phy.x==PICO_SIZE_FULLSCREEN.x && phy.y==PICO_SIZE_FULLSCREEN.y) {
-            pico_assert(0 == SDL_SetWindowFullscreen(WIN, SDL_WINDOW_FULLSCREEN_DESKTOP));
-            phy = PHY;
-        } else {
-            pico_assert(0 == SDL_SetWindowFullscreen(WIN, 0));
-            SDL_SetWindowSize(WIN, phy.x, phy.y);
-        }
+// Applies zoom to the visible size, which is also the window logical size.
+// TEX keeps its contents, since only the composition in present changes.
+static void _pico_set_view (void* arg) {
+    S.size.cur = (Pico_Dim) {
+        MAX(1, S.size.org.x*100/S.view.zoom.x),
+        MAX(1, S.size.org.y*100/S.view.zoom.y)
+    };
+    SDL_SetRenderTarget(REN, NULL);
+    SDL_RenderSetLogicalSize(REN, S.size.cur.x, S.size.cur.y);
+    SDL_SetRenderTarget(REN, _pico_layers.vec[S.layer].tex);
+    _pico_grid_destroy();
+    _pico_dirty_all();
+
+    if (PHY.x==S.size.cur.x || PHY.y==S.size.cur.y) {
+        pico_set_grid(0);
     }
 
-    // logical
+    _pico_output_present(0);
+}
+
+// Recreates the logical-size textures (render side).
+static void _pico_set_size (void* arg) {
+    Pico_Dim log = *(Pico_Dim*)arg;
     if (log.x==PICO_SIZE_KEEP.x && log.y==PICO_SIZE_KEEP.y) {
         // keep
     } else {
-        S.size.cur = log;
+        S.size.org = log;
+        SDL_SetRenderTarget(REN, NULL);
         SDL_DestroyTexture(TEX);
         TEX = SDL_CreateTexture (
             REN, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
-            S.size.cur.x, S.size.cur.y
+            S.size.org.x, S.size.org.y
         );
-        SDL_RenderSetLogicalSize(REN, S.size.cur.x, S.size.cur.y);
         pico_assert(TEX != NULL);
-    }
+        _pico_layers.vec[0].tex = TEX;
 
-    if (PHY.x==S.size.cur.x || PHY.y==S.size.cur.y) {
-        pico_set_grid(0);
-    }
+        // layers follow the logical size
+        for (int i=1; i<_pico_layers.n; i++) {
+            SDL_DestroyTexture(_pico_layers.vec[i].tex);
+            _pico_layers.vec[i].tex = _pico_layer_tex();
+        }
 
-    _pico_output_present(0);
+        // the camera turns around the new center
+        _pico_cam_set(_pico_cam.cam);
+    }
+    _pico_set_view(NULL);
 }
 
 void pico_set_size (Pico_Dim phy, Pico_Dim log) {
-    S.size.org = log;
-    _pico_set_size(phy, log);
+    _pico_sync();
+
+    // physical
+    {
+        if (phy.x==PICO_SIZE_KEEP.x && phy.y==PICO_SIZE_KEEP.y) {
+            // keep
+        } else if (phy.x==PICO_SIZE_FULLSCREEN.x && phy.y==PICO_SIZE_FULLSCREEN.y) {
+            pico_assert(0 == SDL_SetWindowFullscreen(WIN, SDL_WINDOW_FULLSCREEN_DESKTOP));
+            phy = PHY;
+        } else {
+            pico_assert(0 == SDL_SetWindowFullscreen(WIN, 0));
+            SDL_SetWindowSize(WIN, phy.x, phy.y);
+        }
+    }
+
+    // logical
+    _pico_call(_pico_set_size, &log);
 }
 
 void pico_set_show (int on) {
     if (on) {
         SDL_ShowWindow(WIN);
+        _pico_sync();
+        _pico_dirty_all();
         _pico_output_present(0);
     } else {
         SDL_HideWindow(WIN);
@@ -903,17 +3381,6 @@ void pico_set_title (const char* title) {
 }
 
 void pico_set_zoom (Pico_Dim zoom) {
-    S.zoom = zoom;
-    pico_set_scroll ((Pico_Pos) {
-        S.scroll.x - (S.size.org.x - S.size.cur.x)/2,
-        S.scroll.y - (S.size.org.y - S.size.cur.y)/2
-    });
-    _pico_set_size (
-        PICO_SIZE_KEEP,
-        (Pico_Dim){ S.size.org.x*100/zoom.x, S.size.org.y*100/zoom.y }
-    );
-    pico_set_scroll ((Pico_Pos) {
-        S.scroll.x + (S.size.org.x - S.size.cur.x)/2,
-        S.scroll.y + (S.size.org.y - S.size.cur.y)/2
-    });
+    S.view.zoom = zoom;
+    _pico_call(_pico_set_view, NULL);
 }
@@ -15,12 +15,19 @@ extern "C" {
 #define PICO_DIM_PHY ((Pico_Dim) {640,360})
 #define PICO_DIM_LOG ((Pico_Dim) { 64, 36})
 #define PICO_HASH  128
+#define PICO_LAYERS 16
+#define PICO_FRAME  (64*1024)
+#define PICO_STACK  16
+#define PICO_CHANNELS 16
+#define PICO_FONTS  8
+#define PICO_WATCH  16
 
 /// @example init.c
 /// @example delay.c
 /// @example event.c
 /// @example event_timeout.c
 /// @example event_loop.c
+/// @example poll.c
 
 /// @defgroup Types
 /// @brief TODO.
@@ -32,6 +39,28 @@ typedef SDL_Rect  Pico_Rect;
 typedef SDL_Color Pico_Color;
 typedef SDL_Point Pico_Anchor;
 
+/// @brief Rectangles in structure-of-arrays layout, for batch tests.
+/// @sa pico_rect_vs_rects_soa
+typedef struct Pico_Rects {
+    const int* x;
+    const int* y;
+    const int* w;
+    const int* h;
+} Pico_Rects;
+
+/// @brief Particle system, created by @ref pico_particles_create.
+typedef struct Pico_Particles Pico_Particles;
+
+/// @brief View transform applied to everything drawn.
+/// @sa pico_set_camera
+typedef struct Pico_Camera {
+    float x, y;     ///< pan, in logical pixels, like the scroll
+    float zoom;     ///< scale around the center of the screen (1 for none)
+    float angle;    ///< rotation around the center of the screen (in degrees)
+} Pico_Camera;
+
+#define PICO_CAMERA_NONE ((Pico_Camera) {0, 0, 1, 0})
+
 #define PICO_LEFT   0
 #define PICO_CENTER 50
 #define PICO_RIGHT  100
@@ -55,6 +84,33 @@ typedef struct Pico_Size {
 #define PICO_SIZE_KEEP       ((Pico_Dim) {0,0})
 #define PICO_SIZE_FULLSCREEN ((Pico_Dim) {0,1})
 
+/// @brief Rendering counters collected since initialization.
+/// @sa pico_get_stats
+typedef struct Pico_Stats {
+    Uint32 frames;      ///< number of presents to the window
+    struct {
+        Uint32 pixels;  ///< window pixels copied in the last present
+        Uint64 total;   ///< window pixels copied in all presents
+    } copy;
+    struct {
+        Uint32 size;    ///< bytes reserved for the frame arena
+        Uint32 peak;    ///< most bytes used by the arena in a frame
+    } frame;
+    struct {
+        Uint32 calls;   ///< draw color and blend mode changes sent to SDL
+        Uint32 avoided; ///< changes skipped because the value was already set
+    } state;
+    struct {
+        Uint32 video;   ///< microseconds to open the window and renderer
+        Uint32 audio;   ///< microseconds to open the audio device, on first use
+        Uint32 font;    ///< microseconds to open the first font, on first use
+    } init;
+    struct {
+        Uint32 hits;    ///< images read decoded from `PICO_IMAGE_CACHE`
+        Uint32 misses;  ///< images decoded and then stored in the cache
+    } cache;
+} Pico_Stats;
+
 /// @}
 
 /// @defgroup Init
@@ -64,6 +120,25 @@ typedef struct Pico_Size {
 /// @brief Initializes and terminates pico.
 /// @include init.c
 /// @param on 1 to initialize, or 0 to terminate
+/// @remark With the environment variable `PICO_THREAD=1`, drawing is
+///   queued and rendered by a separate thread, one frame behind the caller.
+/// @remark Only video is initialized here: fonts and audio open when first
+///   used, so programs without text or sound start faster.
+/// @remark The environment variables `PICO_AUDIO_FREQ` (default 44100) and
+///   `PICO_AUDIO_BUFFER` (default 1024 sample frames) configure the audio
+///   device, trading latency for robustness against underruns.
+/// @remark With the environment variable `PICO_IMAGE_CACHE` set to a
+///   directory, decoded images are stored there and reused by later runs
+///   while the source file keeps its modification time and size.
+/// @remark With the environment variable `PICO_WATCH=1` (Linux only),
+///   cached images and sounds whose files change are reloaded in place at
+///   the next present, in up to `PICO_WATCH` directories.
+/// @remark With the environment variable `PICO_INPUT_RECORD` set to a file,
+///   user input handled by pico is logged there with its time. With
+///   `PICO_INPUT_REPLAY` set to such a file, live input is ignored and the
+///   logged input is delivered at the same times, or at once in virtual
+///   time with `PICO_INPUT_FAST=1`. Live input resumes when the log ends.
+/// @sa pico_get_latency
 void pico_init (int on);
 
 /// @}
@@ -74,10 +149,21 @@ void pico_init (int on);
 
 /// @brief Stops the program until a given number of milliseconds have passed.
 /// @include delay.c
+/// Events that arrive meanwhile are handled as in @ref pico_input_event.
+/// The wait sleeps until close to the end and then spins on a
+/// high-resolution counter, so it does not overshoot.
 /// @param ms milliseconds to wait
+/// @sa pico_input_delay_us
 void pico_input_delay (int ms);
 
+/// @brief Stops the program until a given number of microseconds have passed.
+/// @param us microseconds to wait
+/// @sa pico_input_delay
+void pico_input_delay_us (Uint64 us);
+
 /// @brief Stops the program until an event occurs.
+/// Consecutive mouse motions are merged into the last one, with their
+/// relative motions summed.
 /// @include event.c
 /// @param evt where to save the event data, or NULL to ignore
 /// @param type type of event to wait for (Pico_EventType)
@@ -98,11 +184,40 @@ int  pico_input_event_ask (Pico_Event* evt, int type);
 /// @param evt where to save the event data, or NULL to ignore
 /// @param type type of event to wait for (Pico_EventType)
 /// @param timeout time limit to wait for events in milliseconds
-/// @return 1 if the given type of event has occurred, or 0 otherwise
+/// @return 1 if the given type of event has occurred, or 0 when the time
+///   limit is reached or an event of another type occurs first
 /// @sa pico_input_event
 /// @sa pico_input_event_ask
 int  pico_input_event_timeout (Pico_Event* evt, int type, int timeout);
 
+/// @brief Stops the program until one of a set of events occurs or a
+///   timeout is reached.
+/// @param evt where to save the event data, or NULL to ignore
+/// @param types types of events to wait for (Pico_EventType)
+/// @param n number of types
+/// @param timeout time limit in milliseconds, or -1 to wait forever
+/// @return 1 if one of the given types of event has occurred, or 0 otherwise
+/// @remark Unlike @ref pico_input_event_timeout, events of other types are
+///   handled and discarded, and the wait goes on until the time limit.
+/// @sa pico_set_event
+int  pico_input_event_any (Pico_Event* evt, const int types[], int n, int timeout);
+
+/// @brief Takes all pending events of a set of types at once.
+/// Events are handled as in @ref pico_input_event_ask, but the queue is
+/// drained in batches instead of one event per call.
+/// @param buf where to save the events
+/// @param max size of buf
+/// @param types types of events to take (Pico_EventType)
+/// @param n number of types
+/// @return number of events saved in buf
+int  pico_input_events (Pico_Event buf[], int max, const int types[], int n);
+
+/// @brief Samples the keyboard and mouse, once per frame.
+/// Queries such as @ref pico_get_key answer from this snapshot, without
+/// consuming events, and compare it with the previous one to detect edges.
+/// @include poll.c
+void pico_input_poll (void);
+
 /// @}
 
 /// @defgroup Output
@@ -127,6 +242,14 @@ void pico_output_draw_image (Pico_Pos pos, const char* path);
 /// @param p2 second point
 void pico_output_draw_line (Pico_Pos p1, Pico_Pos p2);
 
+/// @brief Replays the drawing operations recorded in a list.
+/// The operations are replayed with the positions, colors and images
+/// resolved at recording time, and the screen is updated only once.
+/// @param pos offset added to all recorded positions
+/// @param name name of the list
+/// @sa pico_set_record
+void pico_output_draw_list (Pico_Pos pos, const char* name);
+
 /// @brief Draws a single pixel.
 /// @param pos drawing position
 void pico_output_draw_pixel (Pico_Pos pos);
@@ -144,11 +267,33 @@ void pico_output_draw_rect (Pico_Rect rect);
 /// @param rect bounds of the ellipse
 void pico_output_draw_oval (Pico_Rect rect);
 
+/// @brief Draws all live particles of a system at once.
+/// Each particle is a pixel that fades out with its life.
+/// @param ps particle system
+void pico_output_draw_particles (Pico_Particles* ps);
+
 /// @brief Draws text. The string can't be empty.
 /// @param pos drawing position
 /// @param text text to draw
 void pico_output_draw_text (Pico_Pos pos, const char* text);
 
+/// @brief Plays music in a loop, replacing the current one.
+/// Unlike @ref pico_output_sound, the file is streamed while playing, so
+/// only a small decode buffer is kept in memory, regardless of its length.
+/// @param path path to the audio file, or NULL to stop the music
+/// @sa pico_output_music_ext
+void pico_output_music (const char* path);
+
+/// @brief Plays music, replacing the current one.
+/// A single music plays at a time, so the current one fades out before
+/// the new one fades in.
+/// @param path path to the audio file, or NULL to stop the music
+/// @param loops number of times to play, or -1 to loop forever
+/// @param fade duration of each fade in milliseconds, or 0 to switch at once
+/// @sa pico_set_music_pause
+/// @sa pico_set_music_volume
+void pico_output_music_ext (const char* path, int loops, int fade);
+
 /// @brief Shows what has been drawn onto the screen.
 void pico_output_present (void);
 
@@ -159,7 +304,10 @@ const char* pico_output_screenshot (const char* path);
 const char* pico_output_screenshot_ext (const char* path, Pico_Rect r);
 
 /// @brief Plays a sound.
-/// This function uses caching, so the file is actually loaded only once.
+/// This function uses caching, so the file is actually loaded only once,
+/// already converted to the audio device format.
+/// Up to `PICO_CHANNELS` sounds play at once: when all are busy, the
+/// oldest one is stopped.
 /// @param path path to the audio file
 void pico_output_sound (const char* path);
 
@@ -179,15 +327,64 @@ void pico_output_writeln (const char* text);
 
 /// @}
 
+/// @defgroup Particles
+/// @brief Many short-lived pixels, updated and drawn in batches.
+/// @{
+
+/// @brief Creates a particle system.
+/// @param max maximum number of live particles
+/// @return the particle system
+Pico_Particles* pico_particles_create (int max);
+
+/// @brief Destroys a particle system.
+/// @param ps particle system
+void pico_particles_destroy (Pico_Particles* ps);
+
+/// @brief Gets the number of live particles.
+/// @param ps particle system
+int pico_particles_count (Pico_Particles* ps);
+
+/// @brief Emits particles in random directions, with the current draw color.
+/// Particles beyond the maximum of the system are not emitted.
+/// @param ps particle system
+/// @param n number of particles
+/// @param pos starting position
+/// @param speed maximum speed, in pixels per second
+/// @param life seconds until they disappear, positive
+void pico_particles_emit (Pico_Particles* ps, int n, Pico_Pos pos, float speed, float life);
+
+/// @brief Moves particles and removes the ones whose life ended.
+/// @param ps particle system
+/// @param dt elapsed seconds
+/// @param ax horizontal acceleration, in pixels per second squared
+/// @param ay vertical acceleration, in pixels per second squared
+void pico_particles_update (Pico_Particles* ps, float dt, float ax, float ay);
+
+/// @}
+
 /// @defgroup State
 /// @brief All getters and setters.
 /// @{
 
+// STACK
+
+/// @brief Saves the drawing state: anchor, colors, cursor, image crop and
+/// size, scroll, style, flip and rotation.
+/// @sa pico_pop
+void pico_push (void);
+
+/// @brief Restores the drawing state saved by the last @ref pico_push.
+void pico_pop (void);
+
 // GET
 
 /// @brief Gets the reference point used to draw objects (center, topleft, etc).
 Pico_Anchor pico_get_anchor (void);
 
+/// @brief Gets the camera applied to drawing operations.
+/// @sa pico_set_camera
+Pico_Camera pico_get_camera (void);
+
 /// @brief Gets the color set to clear the screen.
 /// @sa pico_output_clear
 /// @sa pico_set_color_clear
@@ -202,6 +399,11 @@ Pico_Color pico_get_color_draw (void);
 /// @sa pico_output_writeln
 Pico_Pos pico_get_cursor (void);
 
+/// @brief Checks if an event type enters the event queue.
+/// @param type event type (Pico_EventType)
+/// @sa pico_set_event
+int pico_get_event (int type);
+
 /// @brief Checks the state of expert mode.
 int pico_get_expert (void);
 
@@ -222,6 +424,62 @@ Pico_Rect pico_get_image_crop (void);
 /// @param file path to image file
 Pico_Dim pico_get_image_size (const char* file);
 
+/// @brief Checks if a key is held, as of the last @ref pico_input_poll.
+/// @param key key to check (PICO_KEY)
+int pico_get_key (int key);
+
+/// @brief Checks if a key went down between the last two polls.
+/// @param key key to check (PICO_KEY)
+/// @sa pico_input_poll
+int pico_get_key_pressed (int key);
+
+/// @brief Checks if a key went up between the last two polls.
+/// @param key key to check (PICO_KEY)
+/// @sa pico_input_poll
+int pico_get_key_released (int key);
+
+/// @brief Gets the layer that receives drawing operations.
+/// @return the layer name, or NULL for the main screen
+/// @sa pico_set_layer
+const char* pico_get_layer (void);
+
+/// @brief Gets the audio output latency in milliseconds.
+/// This is the duration of the device buffer, which a sound must wait for
+/// before it is heard.
+int pico_get_latency (void);
+
+/// @brief Gets the mouse position, as of the last @ref pico_input_poll.
+/// The position is logical, with the camera and scroll applied, as in
+/// mouse events.
+Pico_Pos pico_get_mouse (void);
+
+/// @brief Checks if a mouse button is held, as of the last @ref pico_input_poll.
+/// @param button button to check (SDL_BUTTON_LEFT, etc.)
+int pico_get_mouse_button (int button);
+
+/// @brief Checks if a mouse button went down between the last two polls.
+/// @param button button to check (SDL_BUTTON_LEFT, etc.)
+/// @sa pico_input_poll
+int pico_get_mouse_pressed (int button);
+
+/// @brief Checks if a mouse button went up between the last two polls.
+/// @param button button to check (SDL_BUTTON_LEFT, etc.)
+/// @sa pico_input_poll
+int pico_get_mouse_released (int button);
+
+/// @brief Gets whether the music is paused.
+/// @sa pico_set_music_pause
+int pico_get_music_pause (void);
+
+/// @brief Gets the music volume, from 0 to 100.
+/// @sa pico_set_music_volume
+int pico_get_music_volume (void);
+
+/// @brief Gets the list being recorded.
+/// @return the list name, or NULL if not recording
+/// @sa pico_set_record
+const char* pico_get_record (void);
+
 /// @brief Gets the rotation angle used to draw objects (in degrees).
 float pico_get_rotate();
 
@@ -234,6 +492,12 @@ Pico_Size pico_get_size (void);
 /// @brief Checks if the aplication window is visible.
 int pico_get_show (void);
 
+/// @brief Gets the rendering counters.
+/// With a software renderer (e.g. `SDL_RENDER_DRIVER=software`), only the
+/// regions touched since the last present are copied to the window.
+/// @sa Pico_Stats
+Pico_Stats pico_get_stats (void);
+
 /// @brief TODO
 PICO_STYLE pico_get_style (void);
 
@@ -247,7 +511,8 @@ Uint32 pico_get_ticks (void);
 /// @brief Gets the aplication title.
 const char* pico_get_title (void);
 
-/// @brief TODO
+/// @brief Gets the zoom of the view, in percent.
+/// @sa pico_set_zoom
 Pico_Dim pico_get_zoom (void);
 
 // SET
@@ -258,6 +523,25 @@ Pico_Dim pico_get_zoom (void);
 /// @param v y-axis anchor
 void pico_set_anchor (Pico_Anchor anchor);
 
+/// @brief Sets an archive, made with `pico-pak`, to load assets from.
+/// Images, sounds, music and fonts are first looked up in the archive by
+/// their paths, and then on disk. The archive is mapped in memory once, so
+/// loading avoids opening many small files. Images packed with `-d` are
+/// already decoded.
+/// The archive can only be set once and stays open until @ref pico_init(0).
+/// @param path path to the archive file
+void pico_set_archive (const char* path);
+
+/// @brief Changes the camera applied to the following drawing operations.
+/// Positions are first anchored and scrolled as usual, and then panned,
+/// zoomed and rotated around the center of the logical screen, with
+/// sub-pixel precision, so nothing is reallocated.
+/// With @ref PICO_CAMERA_NONE, drawing is exact to the pixel as without a
+/// camera. Lists take the camera at the time they are drawn.
+/// @param cam new camera, with a positive zoom
+/// @sa pico_set_scroll
+void pico_set_camera (Pico_Camera cam);
+
 /// @brief Changes the color used to clear the screen.
 /// @param color new color
 /// @sa pico_output_clear
@@ -273,6 +557,14 @@ void pico_set_color_draw (Pico_Color color);
 /// @sa pico_output_writeln
 void pico_set_cursor (Pico_Pos pos);
 
+/// @brief Toggles whether an event type enters the event queue.
+/// Disabled types are dropped by SDL as they occur, so they never wake up
+/// a program waiting for other events.
+/// Disabling @ref PICO_KEYDOWN also disables the Ctrl shortcuts.
+/// @param type event type (Pico_EventType), except quit and window events
+/// @param on 1 to enable it, or 0 to disable it
+void pico_set_event (int type, int on);
+
 /// @brief Toggles the expert mode.
 /// @param on 1 to enable it, or 0 to disable it
 void pico_set_expert (int on);
@@ -281,8 +573,10 @@ void pico_set_expert (int on);
 void pico_set_flip (PICO_FLIP flip);
 
 /// @brief Changes the font used to draw texts.
-/// @param file path to font file
-/// @param h size of the font
+/// The last `PICO_FONTS` fonts stay open, with their glyph caches, so
+/// switching back to a recent file and size is cheap.
+/// @param file path to font file, or NULL for the default embedded font
+/// @param h size of the font, or 0 for a tenth of the logical height
 void pico_set_font (const char* file, int h);
 
 /// @brief Toggles a grid on top of logical pixels.
@@ -297,6 +591,55 @@ void pico_set_image_crop (Pico_Rect crop);
 /// @param size new size, which may be (0, 0) to disable resizing
 void pico_set_image_size (Pico_Dim size);
 
+/// @brief Changes the layer that receives drawing operations.
+/// Layers are offscreen screens with the logical size, which keep their
+/// contents between frames and are combined with the main screen at each
+/// present, from the lowest to the highest z.
+/// A layer is created transparent on first use and, as the main screen,
+/// is cleared with @ref pico_set_color_clear.
+/// @param name layer name, or NULL for the main screen
+/// @sa pico_set_layer_z
+void pico_set_layer (const char* name);
+
+/// @brief Changes the opacity of a layer.
+/// @param name layer name, or NULL for the main screen
+/// @param alpha opacity, from 0 (invisible) to 255 (opaque)
+void pico_set_layer_alpha (const char* name, Uint8 alpha);
+
+/// @brief Changes the point of view on a layer, independently of the others.
+/// @param name layer name, or NULL for the main screen
+/// @param pos new point of view
+void pico_set_layer_scroll (const char* name, Pico_Pos pos);
+
+/// @brief Toggles the visibility of a layer.
+/// @param name layer name, or NULL for the main screen
+/// @param on 1 to show, or 0 to hide
+void pico_set_layer_show (const char* name, int on);
+
+/// @brief Changes the stacking order of a layer.
+/// Layers with the same z are stacked in creation order, starting with
+/// the main screen at 0. Use a negative z for backgrounds.
+/// @param name layer name, or NULL for the main screen
+/// @param z new stacking order
+void pico_set_layer_z (const char* name, int z);
+
+/// @brief Pauses or resumes the music.
+/// @param on 1 to pause, or 0 to resume
+/// @sa pico_output_music
+void pico_set_music_pause (int on);
+
+/// @brief Sets the music volume, which does not affect sounds.
+/// @param vol volume from 0 to 100
+void pico_set_music_volume (int vol);
+
+/// @brief Starts or stops recording drawing operations into a list.
+/// Operations are still drawn while recording.
+/// Recording into an existing list replaces its contents.
+/// Replays of other lists are not recorded.
+/// @param name name of the list, or NULL to stop recording
+/// @sa pico_output_draw_list
+void pico_set_record (const char* name);
+
 // TODO: document me
 void pico_set_rotate(float angle);
 
@@ -322,8 +665,10 @@ void pico_set_style (PICO_STYLE style);
 /// @param title new title to set
 void pico_set_title (const char* title);
 
-/// @brief TODO
-/// @param TODO
+/// @brief Changes the zoom of the view, in percent.
+/// Zooming only changes which part of the logical screen is shown,
+/// so what has been drawn is preserved.
+/// @param zoom new zoom, such as (200,200) to show half of the screen
 void pico_set_zoom (Pico_Dim zoom);
 
 /// @}
@@ -342,12 +687,36 @@ Pico_Dim pico_dim(int x, int y);
 // TODO: document me
 Pico_Dim pico_dim_ext(Pico_Dim d, int x, int y);
 
+/// @brief Allocates scratch memory that lives until the next present.
+/// Outside expert mode, every drawing operation presents, so the memory
+/// should not be kept across them.
+/// The arena grows to the peak use of a frame, so allocating does not
+/// call `malloc` in steady state.
+/// @param size number of bytes
+/// @return pointer to memory aligned for any type
+/// @sa Pico_Stats
+void* pico_frame_alloc (size_t size);
+
 /// @brief Checks if a point is inside a rectangle.
 /// @param pt point
 /// @param r rectangle
 /// @return 1 if pt is inside r, or 0 otherwise
 int pico_pos_vs_rect (Pico_Pos pt, Pico_Rect r);
 
+/// @brief Checks which rectangles of an array contain a point.
+/// Same as @ref pico_pos_vs_rect on each rectangle, but vectorized with
+/// SSE2 or AVX2 when the processor has them.
+/// @param pt point
+/// @param rs rectangles
+/// @param n number of rectangles
+/// @param ids where to save the indexes of the rectangles hit, room for n
+/// @return number of rectangles hit
+/// @sa pico_pos_vs_rects_soa
+int pico_pos_vs_rects (Pico_Pos pt, const Pico_Rect rs[], int n, int ids[]);
+
+/// @brief Same as @ref pico_pos_vs_rects, with rectangles in separate arrays.
+int pico_pos_vs_rects_soa (Pico_Pos pt, Pico_Rects rs, int n, int ids[]);
+
 /// @brief Returns a screen coordinate based on percentage values.
 /// @param x an integer ranging from 0 to 100
 /// @param y an integer ranging from 0 to 100
@@ -370,6 +739,21 @@ Pico_Pos pico_pos_ext (Pico_Rect r, int x, int y);
 /// @sa pico_rect_vs_rect_ext
 int pico_rect_vs_rect (Pico_Rect r1, Pico_Rect r2);
 
+/// @brief Checks which rectangles of an array overlap a rectangle.
+/// Same as @ref pico_rect_vs_rect_ext on each rectangle, with the current
+/// anchor for all of them, but vectorized with SSE2 or AVX2 when the
+/// processor has them.
+/// @param r rectangle
+/// @param rs rectangles
+/// @param n number of rectangles
+/// @param ids where to save the indexes of the rectangles hit, room for n
+/// @return number of rectangles hit
+/// @sa pico_rect_vs_rects_soa
+int pico_rect_vs_rects (Pico_Rect r, const Pico_Rect rs[], int n, int ids[]);
+
+/// @brief Same as @ref pico_rect_vs_rects, with rectangles in separate arrays.
+int pico_rect_vs_rects_soa (Pico_Rect r, Pico_Rects rs, int n, int ids[]);
+
 /// @brief Checks if two rectangles with different anchors overlap.
 /// @param r1 rectangle 1
 /// @param a1 anchor for r1
@@ -0,0 +1,1636 @@
+// Default font (tiny.ttf), embedded so that it does not depend on paths.
+// Generated with: xxd -i tiny.ttf | sed 's/^unsigned/static const unsigned/'
+
+#ifndef PICO_TINY_H
+#define PICO_TINY_H
+
+static const unsigned char tiny_ttf[] = {
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x00, 0x03, 0x00, 0xb0,
+  0x4f, 0x53, 0x2f, 0x32, 0x82, 0x78, 0x6f, 0x85, 0x00, 0x00, 0x4b, 0x58,
+  0x00, 0x00, 0x00, 0x4e, 0x63, 0x6d, 0x61, 0x70, 0xf7, 0x95, 0xed, 0xf0,
+  0x00, 0x00, 0x42, 0xb8, 0x00, 0x00, 0x02, 0x18, 0x63, 0x76, 0x74, 0x20,
+  0x59, 0xc3, 0xf9, 0xc5, 0x00, 0x00, 0x03, 0xbc, 0x00, 0x00, 0x00, 0x2e,
+  0x66, 0x70, 0x67, 0x6d, 0x83, 0x33, 0xc2, 0x4f, 0x00, 0x00, 0x03, 0xa8,
+  0x00, 0x00, 0x00, 0x14, 0x67, 0x6c, 0x79, 0x66, 0xa3, 0xb2, 0xdd, 0x17,
+  0x00, 0x00, 0x04, 0x2c, 0x00, 0x00, 0x3a, 0x86, 0x68, 0x64, 0x6d, 0x78,
+  0x1a, 0x6c, 0x6c, 0x34, 0x00, 0x00, 0x44, 0xd0, 0x00, 0x00, 0x06, 0x88,
+  0x68, 0x65, 0x61, 0x64, 0xd6, 0xd2, 0x34, 0xcf, 0x00, 0x00, 0x4b, 0xa8,
+  0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 0x05, 0x61, 0x02, 0x96,
+  0x00, 0x00, 0x4b, 0xe0, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+  0xd3, 0xea, 0x00, 0x3f, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x01, 0x8c,
+  0x6c, 0x6f, 0x63, 0x61, 0x00, 0x0b, 0x4c, 0x1a, 0x00, 0x00, 0x3e, 0xb4,
+  0x00, 0x00, 0x01, 0x90, 0x6d, 0x61, 0x78, 0x70, 0x00, 0xdc, 0x01, 0x0a,
+  0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x91, 0xc1, 0xab, 0x63, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x02, 0xbb,
+  0x70, 0x6f, 0x73, 0x74, 0x09, 0x41, 0x09, 0xf0, 0x00, 0x00, 0x41, 0xd0,
+  0x00, 0x00, 0x00, 0xe8, 0x70, 0x72, 0x65, 0x70, 0x76, 0xc0, 0x1d, 0x58,
+  0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x15,
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a,
+  0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0e,
+  0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x44,
+  0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a,
+  0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x48,
+  0x01, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a,
+  0x01, 0xaf, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05,
+  0x00, 0xa5, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
+  0x00, 0xb4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x22,
+  0x00, 0xd8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+  0x00, 0xc9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x24,
+  0x01, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05,
+  0x01, 0xaa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x37, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x0a,
+  0x00, 0xaa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e,
+  0x00, 0xbb, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x44,
+  0x00, 0xfa, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x0a,
+  0x00, 0xce, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x48,
+  0x01, 0x62, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x0a,
+  0x01, 0xaf, 0x31, 0x39, 0x39, 0x39, 0x2d, 0x32, 0x30, 0x30, 0x33, 0x20,
+  0x2f, 0x20, 0x79, 0x75, 0x6a, 0x69, 0x20, 0x6f, 0x73, 0x68, 0x69, 0x6d,
+  0x6f, 0x74, 0x6f, 0x20, 0x2f, 0x20, 0x30, 0x34, 0x40, 0x64, 0x73, 0x67,
+  0x34, 0x2e, 0x63, 0x6f, 0x6d, 0x20, 0x2f, 0x20, 0x77, 0x77, 0x77, 0x2e,
+  0x30, 0x34, 0x2e, 0x6a, 0x70, 0x2e, 0x6f, 0x72, 0x67, 0x00, 0x31, 0x00,
+  0x39, 0x00, 0x39, 0x00, 0x39, 0x20, 0x10, 0x00, 0x32, 0x00, 0x30, 0x00,
+  0x30, 0x00, 0x33, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x20, 0x00, 0x79, 0x00,
+  0x75, 0x00, 0x6a, 0x00, 0x69, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x73, 0x00,
+  0x68, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0x00,
+  0x20, 0x00, 0x2f, 0x00, 0x20, 0x00, 0x30, 0x00, 0x34, 0x00, 0x40, 0x00,
+  0x64, 0x00, 0x73, 0x00, 0x67, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x63, 0x00,
+  0x6f, 0x00, 0x6d, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x20, 0x00, 0x77, 0x00,
+  0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x34, 0x00, 0x2e, 0x00,
+  0x6a, 0x00, 0x70, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x30,
+  0x34, 0x62, 0x30, 0x33, 0x00, 0x30, 0x00, 0x34, 0x00, 0x62, 0x00, 0x30,
+  0x00, 0x33, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x52, 0x00,
+  0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x30,
+  0x34, 0x62, 0x30, 0x33, 0x00, 0x30, 0x00, 0x34, 0x00, 0x62, 0x00, 0x30,
+  0x00, 0x33, 0x4d, 0x61, 0x63, 0x72, 0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61,
+  0x20, 0x46, 0x6f, 0x6e, 0x74, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x65,
+  0x72, 0x20, 0x34, 0x2e, 0x31, 0x4a, 0x20, 0x30, 0x34, 0x62, 0x30, 0x33,
+  0x00, 0x4d, 0x00, 0x61, 0x00, 0x63, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6d,
+  0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46,
+  0x00, 0x6f, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x72,
+  0x00, 0x61, 0x00, 0x70, 0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20,
+  0x00, 0x34, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x20, 0x00, 0x30,
+  0x00, 0x34, 0x00, 0x62, 0x00, 0x30, 0x00, 0x33, 0x4d, 0x61, 0x63, 0x72,
+  0x6f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x6f,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x65, 0x72, 0x20, 0x34, 0x2e, 0x31, 0x4a,
+  0x20, 0x30, 0x33, 0x2e, 0x33, 0x2e, 0x32, 0x35, 0x00, 0x4d, 0x00, 0x61,
+  0x00, 0x63, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x64,
+  0x00, 0x69, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e,
+  0xff, 0xff, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x72, 0x00, 0x61, 0x00, 0x70,
+  0x00, 0x68, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x34, 0x00, 0x2e,
+  0x00, 0x31, 0x00, 0x4a, 0x00, 0x20, 0x00, 0x30, 0x00, 0x33, 0x00, 0x2e,
+  0x00, 0x33, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x35, 0x30, 0x34, 0x62, 0x30,
+  0x33, 0x00, 0x30, 0x00, 0x34, 0x00, 0x62, 0x00, 0x30, 0x00, 0x33, 0x00,
+  0x40, 0x01, 0x00, 0x2c, 0x76, 0x45, 0x20, 0xb0, 0x03, 0x25, 0x45, 0x23,
+  0x61, 0x68, 0x18, 0x23, 0x68, 0x60, 0x44, 0x2d, 0xff, 0x06, 0x00, 0x00,
+  0x01, 0xf4, 0x02, 0x71, 0x00, 0x7d, 0x00, 0xfa, 0x00, 0x7d, 0x00, 0xfa,
+  0x01, 0x77, 0x01, 0x77, 0x5a, 0x67, 0x12, 0x06, 0xd2, 0xb8, 0x6a, 0x18,
+  0xf8, 0x2a, 0x61, 0xa3, 0x0e, 0x40, 0xee, 0xd2, 0x80, 0x3a, 0x27, 0x55,
+  0xa2, 0x87, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x40, 0x0d, 0x09, 0x09,
+  0x08, 0x08, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x8d,
+  0xb8, 0x01, 0xff, 0x85, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68,
+  0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0x45, 0x68, 0x44, 0xb3, 0x05,
+  0x04, 0x46, 0x00, 0x2b, 0xb3, 0x07, 0x06, 0x46, 0x00, 0x2b, 0xb1, 0x04,
+  0x04, 0x45, 0x68, 0x44, 0xb1, 0x06, 0x06, 0x45, 0x68, 0x44, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x01, 0xb6, 0x02, 0xee, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x56, 0x40, 0x20, 0x01, 0x08, 0x08, 0x40, 0x09, 0x02,
+  0x07, 0x04, 0x04, 0x01, 0x00, 0x06, 0x05, 0x04, 0x03, 0x02, 0x05, 0x04,
+  0x06, 0x00, 0x07, 0x06, 0x06, 0x01, 0x02, 0x01, 0x03, 0x00, 0x01, 0x01,
+  0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x10,
+  0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c,
+  0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00,
+  0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x33, 0x11, 0x21, 0x11, 0x25, 0x33,
+  0x11, 0x23, 0x3f, 0x01, 0x77, 0xfe, 0xc7, 0xfa, 0xfa, 0x02, 0xee, 0xfd,
+  0x12, 0x3f, 0x02, 0x71, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
+  0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x4e, 0x40, 0x1a, 0x01, 0x08,
+  0x08, 0x40, 0x09, 0x00, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x03, 0x02, 0x06, 0x05, 0x04, 0x01, 0x00, 0x07, 0x06, 0x01, 0x01, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd,
+  0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x08, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0,
+  0x38, 0x59, 0x13, 0x23, 0x11, 0x33, 0x15, 0x23, 0x15, 0x33, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x02, 0x71, 0xfe, 0x89, 0x7d, 0x7d, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x77, 0x01, 0x77, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07,
+  0x00, 0x4e, 0x40, 0x1c, 0x01, 0x08, 0x08, 0x40, 0x09, 0x05, 0x06, 0x05,
+  0x03, 0x00, 0x07, 0x04, 0x04, 0x02, 0x01, 0x07, 0x06, 0x03, 0x03, 0x02,
+  0x05, 0x04, 0x01, 0x03, 0x00, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x00, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x33, 0x35, 0x23,
+  0x17, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0x77, 0xfa,
+  0xfa, 0xfa, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x02, 0x71,
+  0x00, 0x1b, 0x00, 0x1f, 0x00, 0xa7, 0x40, 0x51, 0x01, 0x20, 0x20, 0x40,
+  0x21, 0x00, 0x18, 0x17, 0x14, 0x13, 0x10, 0x0f, 0x0a, 0x09, 0x06, 0x05,
+  0x02, 0x01, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x11, 0x10, 0x0f, 0x0e,
+  0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x03, 0x02, 0x01, 0x00, 0x1f, 0x1c,
+  0x15, 0x14, 0x05, 0x05, 0x04, 0x04, 0x1e, 0x1d, 0x13, 0x12, 0x07, 0x05,
+  0x06, 0x1d, 0x1c, 0x1a, 0x19, 0x0e, 0x05, 0x0d, 0x06, 0x1f, 0x1e, 0x1b,
+  0x0c, 0x0b, 0x05, 0x00, 0x08, 0x07, 0x04, 0x03, 0x03, 0x16, 0x15, 0x12,
+  0x03, 0x11, 0x01, 0x0a, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17,
+  0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f,
+  0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0a, 0x00, 0x20,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x20, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x35, 0x23, 0x35, 0x23, 0x15, 0x23,
+  0x35, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33,
+  0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x07, 0x23, 0x35,
+  0x33, 0x02, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0x83, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x0b, 0x00, 0x15, 0x00, 0x89, 0x40, 0x3b, 0x01, 0x16, 0x16, 0x40,
+  0x17, 0x09, 0x0e, 0x0d, 0x0b, 0x0a, 0x03, 0x02, 0x15, 0x14, 0x13, 0x12,
+  0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x09, 0x08, 0x05, 0x03, 0x04, 0x06,
+  0x06, 0x14, 0x13, 0x07, 0x03, 0x06, 0x06, 0x15, 0x12, 0x11, 0x03, 0x0c,
+  0x01, 0x00, 0x10, 0x0f, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x05, 0x00, 0x16, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x16, 0xff, 0xc0, 0x38, 0x59, 0x01,
+  0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x01,
+  0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x15, 0x01, 0x77, 0x7d,
+  0x7d, 0x7d, 0xfa, 0xfa, 0x7d, 0xfe, 0x89, 0xfa, 0x7d, 0x7d, 0xfa, 0x02,
+  0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x80,
+  0x40, 0x3a, 0x01, 0x14, 0x14, 0x40, 0x15, 0x12, 0x13, 0x10, 0x0f, 0x0e,
+  0x0d, 0x0c, 0x0b, 0x0a, 0x07, 0x06, 0x13, 0x12, 0x02, 0x01, 0x0e, 0x0d,
+  0x06, 0x03, 0x05, 0x05, 0x0b, 0x08, 0x03, 0x03, 0x00, 0x0f, 0x0c, 0x0a,
+  0x03, 0x09, 0x05, 0x11, 0x10, 0x07, 0x03, 0x04, 0x05, 0x04, 0x01, 0x03,
+  0x00, 0x12, 0x11, 0x09, 0x03, 0x08, 0x03, 0x02, 0x02, 0x01, 0x01, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17,
+  0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
+  0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x01, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33,
+  0x25, 0x23, 0x15, 0x33, 0x01, 0x33, 0x35, 0x23, 0x3b, 0x01, 0x35, 0x23,
+  0x17, 0x15, 0x33, 0x35, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0xfe,
+  0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x02, 0x71, 0x7d, 0x7d,
+  0xfa, 0xfe, 0x89, 0xfa, 0x7d, 0xfa, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x71, 0x02, 0x71, 0x00, 0x03, 0x00, 0x1f, 0x00, 0xa3,
+  0x40, 0x5c, 0x01, 0x20, 0x20, 0x40, 0x21, 0x04, 0x15, 0x14, 0x18, 0x17,
+  0x14, 0x13, 0x08, 0x07, 0x03, 0x07, 0x00, 0x04, 0x05, 0x1e, 0x1d, 0x1a,
+  0x19, 0x06, 0x05, 0x05, 0x04, 0x1f, 0x1c, 0x1b, 0x03, 0x04, 0x16, 0x15,
+  0x12, 0x11, 0x0e, 0x0d, 0x0a, 0x09, 0x02, 0x09, 0x01, 0x04, 0x10, 0x0f,
+  0x0c, 0x03, 0x0b, 0x1d, 0x1c, 0x19, 0x18, 0x0d, 0x01, 0x00, 0x07, 0x0c,
+  0x06, 0x1f, 0x1e, 0x0b, 0x0a, 0x07, 0x03, 0x02, 0x07, 0x06, 0x1b, 0x1a,
+  0x17, 0x16, 0x0f, 0x05, 0x0e, 0x06, 0x10, 0x13, 0x12, 0x03, 0x11, 0x10,
+  0x02, 0x09, 0x08, 0x05, 0x03, 0x04, 0x01, 0x01, 0x0b, 0x46, 0x76, 0x2f,
+  0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c,
+  0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
+  0x3c, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0b,
+  0x00, 0x20, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x20, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x23, 0x15, 0x33, 0x17,
+  0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35,
+  0x33, 0x35, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+  0x23, 0x15, 0x33, 0x01, 0x77, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xf9, 0x7b,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x01, 0x77, 0x00, 0x7d, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x3d, 0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x00,
+  0x03, 0x02, 0x01, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x04,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x04, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33, 0x7d, 0x7d, 0x7d,
+  0x02, 0x71, 0xfa, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,
+  0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x5e, 0x40, 0x22,
+  0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0a, 0x09, 0x07, 0x06, 0x05, 0x04,
+  0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x01, 0x00, 0x0b, 0x08, 0x03, 0x02, 0x02, 0x01, 0x05, 0x46, 0x76, 0x2f,
+  0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x05, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33,
+  0x2b, 0x01, 0x11, 0x33, 0x17, 0x35, 0x23, 0x15, 0xfa, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x5e, 0x40, 0x22, 0x01, 0x0c, 0x0c, 0x40,
+  0x0d, 0x04, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x03, 0x00, 0x0b, 0x0a,
+  0x02, 0x01, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x0c, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c,
+  0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x33, 0x35, 0x17, 0x23, 0x11, 0x33,
+  0x2b, 0x01, 0x15, 0x33, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02,
+  0x71, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0xfa, 0x01, 0x77, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x0f, 0x00, 0x13, 0x00, 0x7c, 0x40, 0x3b, 0x01, 0x14, 0x14, 0x40,
+  0x15, 0x08, 0x06, 0x05, 0x11, 0x10, 0x0f, 0x0e, 0x09, 0x08, 0x03, 0x02,
+  0x0d, 0x0c, 0x07, 0x06, 0x01, 0x05, 0x00, 0x04, 0x13, 0x12, 0x0b, 0x0a,
+  0x05, 0x05, 0x04, 0x12, 0x11, 0x0e, 0x0d, 0x07, 0x05, 0x04, 0x06, 0x00,
+  0x0a, 0x09, 0x02, 0x03, 0x01, 0x13, 0x10, 0x0f, 0x03, 0x0c, 0x0b, 0x08,
+  0x03, 0x03, 0x00, 0x02, 0x01, 0x02, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x3f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x10, 0xfd, 0x17,
+  0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x02, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x35,
+  0x23, 0x15, 0x17, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x07, 0x35,
+  0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0x7d, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x01, 0xf4, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x7d, 0x01, 0x77, 0x01, 0xf4, 0x00, 0x0b, 0x00, 0x5d, 0x40, 0x21,
+  0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x03, 0x0b, 0x0a, 0x09, 0x08, 0x05, 0x04,
+  0x03, 0x02, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x01, 0x00, 0x07, 0x06, 0x01, 0x00, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09,
+  0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x37, 0x33, 0x35, 0x33, 0x35,
+  0x23, 0x35, 0x23, 0x15, 0x23, 0x15, 0x33, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0xff, 0x83, 0x00, 0xfa, 0x00, 0x7d, 0x00, 0x03, 0x00, 0x07, 0x00, 0x4e,
+  0x40, 0x1a, 0x01, 0x08, 0x08, 0x40, 0x09, 0x01, 0x01, 0x00, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06,
+  0x01, 0x01, 0x04, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f,
+  0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x04, 0x00,
+  0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x3b, 0x01, 0x35, 0x23, 0x07, 0x33,
+  0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x01, 0x77, 0x01, 0x77, 0x00, 0x03,
+  0x00, 0x3d, 0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x02, 0x03, 0x02,
+  0x01, 0x00, 0x03, 0x00, 0x02, 0x01, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
+  0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x04, 0x49, 0x68,
+  0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x04, 0xff,
+  0xc0, 0x38, 0x59, 0x11, 0x15, 0x21, 0x35, 0x01, 0x77, 0x01, 0x77, 0x7d,
+  0x7d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x7d,
+  0x00, 0x03, 0x00, 0x3d, 0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x01,
+  0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x01, 0x00, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x04,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x04, 0xff, 0xc0, 0x38, 0x59, 0x31, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0x7d,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x7e, 0x40, 0x32,
+  0x01, 0x14, 0x14, 0x40, 0x15, 0x06, 0x13, 0x12, 0x0f, 0x0e, 0x0d, 0x0c,
+  0x0b, 0x0a, 0x09, 0x08, 0x03, 0x02, 0x01, 0x00, 0x13, 0x12, 0x11, 0x10,
+  0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
+  0x03, 0x02, 0x01, 0x00, 0x07, 0x04, 0x11, 0x10, 0x06, 0x05, 0x02, 0x01,
+  0x10, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f,
+  0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x10, 0x00, 0x14, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14,
+  0xff, 0xc0, 0x38, 0x59, 0x01, 0x33, 0x35, 0x23, 0x37, 0x15, 0x33, 0x35,
+  0x01, 0x33, 0x35, 0x23, 0x3b, 0x01, 0x35, 0x23, 0x03, 0x33, 0x35, 0x23,
+  0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x0c, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x0c,
+  0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x72, 0x40, 0x36,
+  0x01, 0x10, 0x10, 0x40, 0x11, 0x0b, 0x0e, 0x0d, 0x0a, 0x09, 0x01, 0x05,
+  0x00, 0x04, 0x0c, 0x0b, 0x0f, 0x08, 0x07, 0x04, 0x03, 0x05, 0x02, 0x04,
+  0x06, 0x05, 0x02, 0x01, 0x06, 0x08, 0x0d, 0x0c, 0x05, 0x04, 0x03, 0x05,
+  0x00, 0x06, 0x0e, 0x0f, 0x0e, 0x01, 0x09, 0x08, 0x03, 0x0b, 0x0a, 0x07,
+  0x03, 0x06, 0x02, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
+  0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
+  0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x10, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10,
+  0xff, 0xc0, 0x38, 0x59, 0x25, 0x11, 0x23, 0x11, 0x15, 0x23, 0x11, 0x33,
+  0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x01, 0x77, 0xfa, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x7e, 0x01, 0x75, 0xfe, 0x8b, 0x01, 0x01,
+  0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xfa, 0x02, 0x71, 0x00, 0x05, 0x00, 0x46, 0x40, 0x16, 0x01, 0x06,
+  0x06, 0x40, 0x07, 0x01, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x03, 0x02,
+  0x01, 0x00, 0x05, 0x04, 0x02, 0x01, 0x03, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x03, 0x00,
+  0x06, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x06, 0xff, 0xc0, 0x38, 0x59, 0x3b, 0x01, 0x11, 0x23, 0x15, 0x33,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x02, 0x71, 0x7d, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x11, 0x00, 0x7a, 0x40, 0x33, 0x01, 0x12, 0x12, 0x40, 0x13, 0x05,
+  0x07, 0x06, 0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0b, 0x08, 0x05, 0x03,
+  0x04, 0x06, 0x01, 0x11, 0x10, 0x0a, 0x03, 0x09, 0x06, 0x0f, 0x0e, 0x03,
+  0x00, 0x0d, 0x0c, 0x02, 0x01, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd, 0x17,
+  0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00,
+  0x12, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x12, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x21, 0x35, 0x15, 0x33,
+  0x35, 0x23, 0x07, 0x15, 0x33, 0x35, 0x01, 0x21, 0x35, 0x21, 0x35, 0x23,
+  0x01, 0x77, 0x7d, 0x7d, 0xfa, 0xfa, 0xfe, 0x89, 0x01, 0xf4, 0xfe, 0x89,
+  0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89,
+  0x7d, 0x7d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x82,
+  0x40, 0x38, 0x01, 0x14, 0x14, 0x40, 0x15, 0x05, 0x07, 0x06, 0x13, 0x12,
+  0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0b, 0x08, 0x05, 0x03, 0x04, 0x06,
+  0x09, 0x0e, 0x0d, 0x0a, 0x03, 0x09, 0x06, 0x13, 0x10, 0x0f, 0x03, 0x0c,
+  0x03, 0x00, 0x12, 0x11, 0x02, 0x01, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f,
+  0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15,
+  0x21, 0x35, 0x15, 0x33, 0x35, 0x23, 0x07, 0x15, 0x33, 0x35, 0x17, 0x35,
+  0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0xfa,
+  0x7d, 0x7d, 0xfe, 0x89, 0x01, 0x77, 0x02, 0x71, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x11, 0x00, 0x7c,
+  0x40, 0x3b, 0x01, 0x12, 0x12, 0x40, 0x13, 0x06, 0x07, 0x06, 0x11, 0x10,
+  0x0b, 0x0a, 0x03, 0x05, 0x02, 0x04, 0x09, 0x08, 0x05, 0x03, 0x04, 0x0f,
+  0x0e, 0x01, 0x03, 0x00, 0x04, 0x0d, 0x0c, 0x0e, 0x0d, 0x03, 0x03, 0x00,
+  0x06, 0x0f, 0x06, 0x05, 0x02, 0x03, 0x01, 0x06, 0x0c, 0x0b, 0x08, 0x03,
+  0x07, 0x10, 0x0f, 0x02, 0x0a, 0x09, 0x01, 0x11, 0x04, 0x03, 0x01, 0x0c,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f,
+  0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e,
+  0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0c, 0x00, 0x12, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x12,
+  0xff, 0xc0, 0x38, 0x59, 0x13, 0x15, 0x33, 0x35, 0x37, 0x11, 0x33, 0x15,
+  0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x35, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0x76, 0x7c, 0x7c, 0xfb,
+  0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+  0x00, 0x72, 0x40, 0x2f, 0x01, 0x10, 0x10, 0x40, 0x11, 0x02, 0x0f, 0x0e,
+  0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x01, 0x00, 0x07, 0x00, 0x06, 0x01, 0x09, 0x08, 0x06, 0x03, 0x05, 0x06,
+  0x0e, 0x0d, 0x0b, 0x03, 0x0a, 0x04, 0x03, 0x0f, 0x0c, 0x02, 0x01, 0x02,
+  0x01, 0x04, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c,
+  0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x04, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x35, 0x21, 0x35,
+  0x21, 0x11, 0x21, 0x35, 0x17, 0x23, 0x15, 0x33, 0x07, 0x35, 0x21, 0x15,
+  0x7d, 0x01, 0x77, 0xfe, 0x0c, 0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe,
+  0x89, 0x01, 0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x13, 0x00, 0x81, 0x40, 0x40, 0x01, 0x14, 0x14, 0x40,
+  0x15, 0x0f, 0x0b, 0x0a, 0x12, 0x11, 0x0e, 0x0d, 0x0a, 0x09, 0x01, 0x07,
+  0x00, 0x04, 0x10, 0x0f, 0x13, 0x0c, 0x0b, 0x08, 0x07, 0x04, 0x03, 0x07,
+  0x02, 0x04, 0x06, 0x05, 0x0d, 0x0c, 0x06, 0x01, 0x0f, 0x02, 0x01, 0x03,
+  0x0e, 0x06, 0x04, 0x11, 0x10, 0x05, 0x04, 0x03, 0x05, 0x00, 0x06, 0x12,
+  0x13, 0x12, 0x01, 0x09, 0x08, 0x03, 0x07, 0x06, 0x02, 0x01, 0x05, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f,
+  0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x2e, 0x2e,
+  0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x14, 0x49, 0x68,
+  0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff,
+  0xc0, 0x38, 0x59, 0x25, 0x35, 0x23, 0x1d, 0x01, 0x23, 0x11, 0x33, 0x35,
+  0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x01,
+  0x77, 0xfa, 0x7d, 0x7d, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0xfa, 0x7e, 0x7b,
+  0x7b, 0x01, 0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x05, 0x00, 0x09,
+  0x00, 0x0d, 0x00, 0x6c, 0x40, 0x2c, 0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x04,
+  0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x01, 0x00, 0x0b, 0x0a, 0x09, 0x03, 0x08, 0x07, 0x01, 0x0d, 0x0c, 0x04,
+  0x03, 0x03, 0x06, 0x01, 0x05, 0x00, 0x07, 0x06, 0x02, 0x01, 0x02, 0x01,
+  0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f,
+  0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x0e, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e,
+  0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x21, 0x15, 0x33, 0x35, 0x01, 0x33,
+  0x35, 0x23, 0x3b, 0x01, 0x35, 0x23, 0x01, 0x77, 0x7d, 0xfe, 0x89, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfa, 0xfd, 0x8f, 0xfa,
+  0x7d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x9c, 0x40, 0x56, 0x01, 0x1c,
+  0x1c, 0x40, 0x1d, 0x13, 0x1a, 0x19, 0x16, 0x15, 0x12, 0x11, 0x05, 0x04,
+  0x01, 0x09, 0x00, 0x04, 0x18, 0x17, 0x14, 0x03, 0x13, 0x1b, 0x10, 0x0f,
+  0x0c, 0x0b, 0x08, 0x07, 0x06, 0x03, 0x09, 0x02, 0x04, 0x0e, 0x0d, 0x0a,
+  0x03, 0x09, 0x02, 0x01, 0x06, 0x10, 0x17, 0x16, 0x0b, 0x06, 0x05, 0x05,
+  0x0a, 0x06, 0x08, 0x15, 0x14, 0x0d, 0x03, 0x00, 0x05, 0x0c, 0x06, 0x0e,
+  0x19, 0x18, 0x09, 0x08, 0x07, 0x05, 0x04, 0x06, 0x1a, 0x1b, 0x1a, 0x01,
+  0x11, 0x10, 0x03, 0x13, 0x12, 0x0f, 0x03, 0x0e, 0x02, 0x01, 0x09, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
+  0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x09, 0x00, 0x1c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x1c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x35, 0x23, 0x15,
+  0x17, 0x35, 0x23, 0x1d, 0x01, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33,
+  0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
+  0x01, 0x77, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xfa, 0x01, 0x78, 0x7b, 0x7b, 0xfa, 0x7b, 0x7b, 0x01, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x13, 0x00, 0x86,
+  0x40, 0x43, 0x01, 0x14, 0x14, 0x40, 0x15, 0x0f, 0x12, 0x11, 0x0e, 0x0d,
+  0x06, 0x05, 0x03, 0x07, 0x02, 0x04, 0x10, 0x0f, 0x13, 0x0c, 0x0b, 0x08,
+  0x07, 0x04, 0x01, 0x07, 0x00, 0x04, 0x0a, 0x09, 0x03, 0x00, 0x06, 0x0c,
+  0x07, 0x06, 0x06, 0x01, 0x09, 0x02, 0x01, 0x03, 0x08, 0x06, 0x0a, 0x11,
+  0x10, 0x05, 0x03, 0x04, 0x06, 0x12, 0x13, 0x12, 0x01, 0x0d, 0x0c, 0x03,
+  0x0f, 0x0e, 0x0b, 0x03, 0x0a, 0x02, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17,
+  0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x10, 0xfd, 0x3c, 0x01,
+  0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x14, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0,
+  0x38, 0x59, 0x13, 0x15, 0x33, 0x35, 0x03, 0x33, 0x35, 0x23, 0x35, 0x23,
+  0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x7d, 0xfa,
+  0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x01, 0xf3, 0x7b,
+  0x7b, 0xfe, 0x8a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x7d, 0x01, 0xf4, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x4e, 0x40, 0x1a, 0x01, 0x08, 0x08, 0x40, 0x09, 0x01,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01, 0x00, 0x06, 0x07,
+  0x06, 0x03, 0x02, 0x05, 0x04, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x33,
+  0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0x77,
+  0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
+  0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x4e, 0x40, 0x1a, 0x01, 0x08,
+  0x08, 0x40, 0x09, 0x00, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x05, 0x04, 0x06, 0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x01, 0x01, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd,
+  0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x08, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0,
+  0x38, 0x59, 0x13, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x01, 0xf4, 0x7d, 0x7d, 0xfa, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x0f, 0x00, 0x13, 0x00, 0x85, 0x40, 0x39, 0x01, 0x14, 0x14, 0x40,
+  0x15, 0x05, 0x12, 0x11, 0x13, 0x12, 0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c,
+  0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x03, 0x02, 0x09, 0x00, 0x0f, 0x0c, 0x09, 0x08, 0x0e, 0x0d, 0x09, 0x03,
+  0x08, 0x06, 0x0b, 0x0a, 0x01, 0x03, 0x00, 0x07, 0x06, 0x13, 0x10, 0x05,
+  0x04, 0x02, 0x01, 0x08, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
+  0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x08,
+  0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x33, 0x35, 0x23, 0x3b,
+  0x01, 0x35, 0x23, 0x03, 0x33, 0x35, 0x23, 0x17, 0x35, 0x23, 0x15, 0x17,
+  0x35, 0x23, 0x15, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d,
+  0xfa, 0x7d, 0xfa, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0xfa,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7d,
+  0x01, 0x77, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x4e, 0x40, 0x1a,
+  0x01, 0x08, 0x08, 0x40, 0x09, 0x02, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x06, 0x07, 0x04, 0x03, 0x00, 0x06, 0x05, 0x01,
+  0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f,
+  0x3c, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x08, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x08,
+  0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35,
+  0x01, 0x77, 0xfe, 0x89, 0x01, 0x77, 0x01, 0xf4, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x82,
+  0x40, 0x37, 0x01, 0x14, 0x14, 0x40, 0x15, 0x0d, 0x13, 0x12, 0x07, 0x04,
+  0x13, 0x12, 0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x09, 0x08, 0x09, 0x0a,
+  0x0d, 0x0c, 0x0b, 0x03, 0x0a, 0x06, 0x0f, 0x0e, 0x06, 0x03, 0x05, 0x03,
+  0x00, 0x11, 0x10, 0x02, 0x01, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
+  0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15,
+  0x33, 0x35, 0x1d, 0x01, 0x33, 0x35, 0x03, 0x33, 0x35, 0x23, 0x3b, 0x01,
+  0x35, 0x23, 0x03, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xfe, 0x89, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x0f, 0x00, 0x72, 0x40, 0x2e, 0x01, 0x10, 0x10, 0x40, 0x11, 0x05,
+  0x07, 0x06, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0b, 0x08, 0x05, 0x03, 0x04, 0x06,
+  0x01, 0x0a, 0x09, 0x06, 0x0f, 0x0e, 0x03, 0x00, 0x0d, 0x0c, 0x02, 0x01,
+  0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15,
+  0x21, 0x35, 0x15, 0x33, 0x35, 0x23, 0x07, 0x15, 0x33, 0x35, 0x03, 0x33,
+  0x35, 0x23, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0x02,
+  0x71, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x09, 0x00, 0x15, 0x00, 0x8a, 0x40, 0x45, 0x01, 0x16, 0x16, 0x40,
+  0x17, 0x0a, 0x13, 0x12, 0x0f, 0x0e, 0x06, 0x05, 0x05, 0x04, 0x11, 0x10,
+  0x07, 0x15, 0x14, 0x0d, 0x0c, 0x09, 0x04, 0x01, 0x07, 0x00, 0x04, 0x0b,
+  0x0a, 0x03, 0x02, 0x04, 0x08, 0x07, 0x02, 0x01, 0x06, 0x09, 0x08, 0x05,
+  0x04, 0x06, 0x13, 0x10, 0x0f, 0x0c, 0x0b, 0x07, 0x06, 0x03, 0x07, 0x00,
+  0x06, 0x0d, 0x14, 0x13, 0x03, 0x0e, 0x0d, 0x01, 0x15, 0x12, 0x11, 0x03,
+  0x0a, 0x02, 0x01, 0x10, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17,
+  0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c,
+  0x2f, 0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x3c, 0xdd, 0x3c, 0xfd,
+  0x17, 0x3c, 0x10, 0xdd, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x10, 0x00, 0x16, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x16, 0xff, 0xc0, 0x38, 0x59,
+  0x25, 0x35, 0x23, 0x15, 0x13, 0x21, 0x11, 0x33, 0x35, 0x33, 0x37, 0x11,
+  0x23, 0x15, 0x21, 0x35, 0x23, 0x11, 0x33, 0x35, 0x21, 0x15, 0x01, 0xf4,
+  0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0xfa, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d,
+  0x01, 0x77, 0x7e, 0x7c, 0x7c, 0x01, 0x75, 0xfe, 0x8b, 0xf9, 0x7d, 0xfe,
+  0x89, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x72,
+  0x40, 0x35, 0x01, 0x10, 0x10, 0x40, 0x11, 0x04, 0x0d, 0x0c, 0x07, 0x06,
+  0x03, 0x05, 0x02, 0x04, 0x05, 0x04, 0x0f, 0x0e, 0x09, 0x08, 0x01, 0x05,
+  0x00, 0x04, 0x0b, 0x0a, 0x0f, 0x0c, 0x06, 0x08, 0x07, 0x0e, 0x0d, 0x06,
+  0x01, 0x0a, 0x09, 0x06, 0x03, 0x05, 0x01, 0x02, 0x01, 0x03, 0x0b, 0x04,
+  0x03, 0x03, 0x00, 0x02, 0x01, 0x0a, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x2f,
+  0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
+  0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0a, 0x00,
+  0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x35, 0x33, 0x15, 0x33, 0x11,
+  0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x05, 0x35, 0x23, 0x15, 0x7d, 0xfa,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x01, 0x77, 0xfa, 0x01, 0xf4, 0x7d, 0x7d, 0xfe,
+  0x0c, 0x7d, 0x7d, 0x01, 0xf4, 0xfa, 0xf9, 0xf9, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
+  0x00, 0x88, 0x40, 0x44, 0x01, 0x14, 0x14, 0x40, 0x15, 0x08, 0x12, 0x11,
+  0x0e, 0x0d, 0x0a, 0x09, 0x07, 0x04, 0x02, 0x09, 0x01, 0x04, 0x13, 0x10,
+  0x0f, 0x03, 0x08, 0x06, 0x05, 0x03, 0x03, 0x00, 0x04, 0x0c, 0x0b, 0x03,
+  0x02, 0x06, 0x0c, 0x13, 0x05, 0x04, 0x03, 0x12, 0x06, 0x08, 0x09, 0x08,
+  0x07, 0x03, 0x06, 0x06, 0x0a, 0x11, 0x01, 0x00, 0x03, 0x10, 0x06, 0x0e,
+  0x0f, 0x0e, 0x02, 0x0d, 0x0c, 0x03, 0x0b, 0x0a, 0x01, 0x01, 0x0b, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10,
+  0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
+  0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0b, 0x00,
+  0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x33, 0x35, 0x23, 0x17, 0x23,
+  0x15, 0x33, 0x17, 0x23, 0x15, 0x21, 0x11, 0x21, 0x15, 0x33, 0x15, 0x23,
+  0x15, 0x33, 0x7d, 0xfa, 0xfa, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0xfe, 0x89,
+  0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x01, 0x78, 0x7b, 0xfa, 0x7b, 0x01, 0x7d,
+  0x02, 0x71, 0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x77, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x5e,
+  0x40, 0x22, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0a, 0x09, 0x07, 0x06,
+  0x05, 0x04, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x01, 0x00, 0x02, 0x01, 0x0b, 0x08, 0x03, 0x00, 0x02, 0x01, 0x05, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x05, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x35,
+  0x23, 0x15, 0x31, 0x23, 0x11, 0x33, 0x17, 0x35, 0x23, 0x15, 0x01, 0x77,
+  0xfa, 0x7d, 0x7d, 0xfa, 0xfa, 0x01, 0xf4, 0x7d, 0x7d, 0xfe, 0x89, 0x7d,
+  0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x0b, 0x00, 0x66, 0x40, 0x2c, 0x01, 0x0c, 0x0c, 0x40,
+  0x0d, 0x09, 0x0b, 0x08, 0x07, 0x04, 0x01, 0x05, 0x00, 0x04, 0x0a, 0x09,
+  0x03, 0x02, 0x04, 0x06, 0x05, 0x02, 0x01, 0x06, 0x06, 0x0b, 0x0a, 0x03,
+  0x03, 0x00, 0x06, 0x04, 0x09, 0x08, 0x02, 0x07, 0x06, 0x03, 0x05, 0x04,
+  0x01, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
+  0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f,
+  0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59,
+  0x25, 0x11, 0x23, 0x11, 0x17, 0x21, 0x11, 0x21, 0x15, 0x33, 0x11, 0x23,
+  0x01, 0x77, 0xfa, 0xfa, 0xfe, 0x89, 0x01, 0x77, 0x7d, 0x7d, 0x7e, 0x01,
+  0x75, 0xfe, 0x8b, 0x7e, 0x02, 0x71, 0x7d, 0xfe, 0x89, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x0b, 0x00, 0x62,
+  0x40, 0x25, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x04, 0x03, 0x06, 0x02,
+  0x01, 0x06, 0x05, 0x06, 0x07, 0x0a, 0x09, 0x0b, 0x00, 0x08, 0x07, 0x02,
+  0x01, 0x0a, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c,
+  0x2f, 0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0a, 0x00, 0x0c, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0,
+  0x38, 0x59, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35,
+  0x21, 0x11, 0x01, 0x77, 0xfa, 0xfa, 0xfa, 0xfa, 0xfe, 0x89, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xfd, 0x8f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x77, 0x02, 0x71, 0x00, 0x09, 0x00, 0x59, 0x40, 0x20, 0x01, 0x0a,
+  0x0a, 0x40, 0x0b, 0x01, 0x01, 0x00, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
+  0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x06, 0x04, 0x07, 0x06, 0x09, 0x08,
+  0x05, 0x04, 0x02, 0x01, 0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30,
+  0x01, 0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x0a, 0x49, 0x68, 0x61, 0xb0,
+  0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0a, 0xff, 0xc0, 0x38,
+  0x59, 0x37, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x21, 0x11, 0x33, 0x7d,
+  0xfa, 0xfa, 0xfa, 0xfe, 0x89, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0xfd, 0x8f,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0f, 0x00, 0x77, 0x40, 0x33, 0x01, 0x10, 0x10, 0x40,
+  0x11, 0x00, 0x05, 0x04, 0x0a, 0x09, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x0e, 0x0d, 0x05, 0x00, 0x0c, 0x0b, 0x04, 0x0f, 0x08, 0x01, 0x03, 0x00,
+  0x0b, 0x0a, 0x07, 0x03, 0x06, 0x06, 0x08, 0x0d, 0x0c, 0x06, 0x0f, 0x0e,
+  0x02, 0x01, 0x09, 0x08, 0x01, 0x03, 0x00, 0x02, 0x01, 0x05, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c,
+  0xfd, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c,
+  0x10, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
+  0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x10,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x10, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x35, 0x21, 0x15, 0x31, 0x23, 0x11,
+  0x33, 0x05, 0x21, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x01, 0xf4, 0xfe,
+  0x89, 0x7d, 0x7d, 0x01, 0x77, 0xfe, 0x89, 0xfa, 0x7d, 0xfa, 0x01, 0xf4,
+  0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x0b, 0x00, 0x5e, 0x40, 0x26,
+  0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x09, 0x07, 0x06, 0x01, 0x00, 0x0a, 0x09,
+  0x04, 0x03, 0x0b, 0x08, 0x07, 0x03, 0x00, 0x05, 0x06, 0x05, 0x02, 0x03,
+  0x01, 0x0b, 0x0a, 0x03, 0x03, 0x02, 0x09, 0x08, 0x05, 0x03, 0x04, 0x01,
+  0x03, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17,
+  0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x03, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x35, 0x23,
+  0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x01, 0x77, 0xfa, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0x77, 0xfa, 0xfd, 0x8f, 0xfa, 0xfa, 0x02,
+  0x71, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71,
+  0x00, 0x0b, 0x00, 0x5e, 0x40, 0x23, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x01,
+  0x0b, 0x0a, 0x07, 0x06, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
+  0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x09, 0x08, 0x05, 0x04, 0x01, 0x03,
+  0x00, 0x02, 0x01, 0x03, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x03, 0x00, 0x0c, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0,
+  0x38, 0x59, 0x13, 0x33, 0x35, 0x21, 0x15, 0x33, 0x11, 0x23, 0x15, 0x21,
+  0x35, 0x23, 0xfa, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x01,
+  0xf4, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0d,
+  0x00, 0x67, 0x40, 0x29, 0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x04, 0x0d, 0x0a,
+  0x09, 0x08, 0x07, 0x06, 0x04, 0x03, 0x07, 0x06, 0x05, 0x04, 0x01, 0x00,
+  0x0d, 0x0c, 0x03, 0x03, 0x02, 0x05, 0x0b, 0x0a, 0x09, 0x03, 0x08, 0x05,
+  0x00, 0x0c, 0x0b, 0x02, 0x01, 0x02, 0x01, 0x06, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2f, 0x17, 0x3c,
+  0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
+  0x00, 0x06, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
+  0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x15, 0x33,
+  0x11, 0x33, 0x11, 0x01, 0x15, 0x33, 0x35, 0x1d, 0x01, 0x33, 0x35, 0xfa,
+  0x7d, 0x7d, 0xfe, 0x0c, 0x7d, 0xfa, 0x02, 0x71, 0x7d, 0xfe, 0x89, 0x01,
+  0xf4, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+  0x00, 0x13, 0x00, 0x17, 0x00, 0x90, 0x40, 0x47, 0x01, 0x18, 0x18, 0x40,
+  0x19, 0x09, 0x16, 0x15, 0x0f, 0x0e, 0x15, 0x14, 0x0a, 0x09, 0x02, 0x01,
+  0x13, 0x12, 0x0f, 0x0c, 0x06, 0x05, 0x05, 0x04, 0x00, 0x17, 0x16, 0x11,
+  0x10, 0x0e, 0x0d, 0x0b, 0x07, 0x08, 0x05, 0x07, 0x04, 0x03, 0x03, 0x00,
+  0x13, 0x10, 0x09, 0x04, 0x12, 0x11, 0x05, 0x03, 0x04, 0x06, 0x0d, 0x0c,
+  0x07, 0x03, 0x06, 0x0b, 0x0a, 0x01, 0x03, 0x00, 0x17, 0x14, 0x03, 0x03,
+  0x02, 0x09, 0x08, 0x02, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x3f, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
+  0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00,
+  0x18, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x18, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x11, 0x33, 0x35, 0x33,
+  0x35, 0x23, 0x37, 0x33, 0x35, 0x23, 0x07, 0x33, 0x35, 0x23, 0x13, 0x35,
+  0x23, 0x15, 0x17, 0x35, 0x23, 0x15, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x02, 0x71, 0xfd,
+  0x8f, 0xfa, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71,
+  0x00, 0x05, 0x00, 0x45, 0x40, 0x15, 0x01, 0x06, 0x06, 0x40, 0x07, 0x00,
+  0x02, 0x01, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x04, 0x03, 0x05, 0x00,
+  0x01, 0x04, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c,
+  0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30,
+  0x01, 0x49, 0x68, 0xb9, 0x00, 0x04, 0x00, 0x06, 0x49, 0x68, 0x61, 0xb0,
+  0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x06, 0xff, 0xc0, 0x38,
+  0x59, 0x21, 0x35, 0x23, 0x11, 0x23, 0x11, 0x01, 0x77, 0xfa, 0x7d, 0x7d,
+  0x01, 0xf4, 0xfd, 0x8f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71,
+  0x02, 0x71, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x84, 0x40, 0x3c,
+  0x01, 0x14, 0x14, 0x40, 0x15, 0x11, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a,
+  0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x12, 0x11, 0x03, 0x02, 0x05, 0x04,
+  0x01, 0x03, 0x00, 0x04, 0x06, 0x0b, 0x08, 0x07, 0x03, 0x06, 0x04, 0x09,
+  0x0e, 0x0d, 0x0a, 0x03, 0x09, 0x04, 0x13, 0x10, 0x0f, 0x03, 0x0c, 0x13,
+  0x12, 0x02, 0x03, 0x01, 0x11, 0x10, 0x04, 0x03, 0x03, 0x01, 0x02, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x01,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x02, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x35,
+  0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x15, 0x33, 0x35, 0x23, 0x37, 0x23,
+  0x15, 0x33, 0x11, 0x33, 0x11, 0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4, 0x7d, 0xfd, 0x8f, 0x01, 0x77,
+  0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x02, 0x71, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x07, 0x00, 0x0f,
+  0x00, 0x71, 0x40, 0x31, 0x01, 0x10, 0x10, 0x40, 0x11, 0x02, 0x0b, 0x0a,
+  0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x0e, 0x0d, 0x03, 0x02, 0x05, 0x04,
+  0x01, 0x03, 0x00, 0x04, 0x06, 0x0a, 0x09, 0x07, 0x03, 0x06, 0x04, 0x0f,
+  0x0c, 0x0b, 0x03, 0x08, 0x0d, 0x0c, 0x04, 0x03, 0x03, 0x0f, 0x0e, 0x02,
+  0x03, 0x01, 0x01, 0x0d, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17,
+  0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x0d,
+  0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x15, 0x33, 0x11, 0x23,
+  0x15, 0x23, 0x15, 0x27, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x01,
+  0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0xfa, 0x02,
+  0x71, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xfd, 0x8f, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x72,
+  0x40, 0x36, 0x01, 0x10, 0x10, 0x40, 0x11, 0x0b, 0x0e, 0x0d, 0x0a, 0x09,
+  0x01, 0x05, 0x00, 0x04, 0x0c, 0x0b, 0x0f, 0x08, 0x07, 0x04, 0x03, 0x05,
+  0x02, 0x04, 0x06, 0x05, 0x02, 0x01, 0x06, 0x08, 0x0d, 0x0c, 0x05, 0x04,
+  0x03, 0x05, 0x00, 0x06, 0x0e, 0x0f, 0x0e, 0x01, 0x09, 0x08, 0x03, 0x0b,
+  0x0a, 0x07, 0x03, 0x06, 0x02, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
+  0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd,
+  0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00,
+  0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x11, 0x23, 0x11, 0x15, 0x23,
+  0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23, 0x15, 0x23, 0x01, 0x77,
+  0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x7e, 0x01, 0x75, 0xfe, 0x8b,
+  0x01, 0x01, 0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x6c,
+  0x40, 0x30, 0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x01, 0x0d, 0x0a, 0x06, 0x03,
+  0x05, 0x04, 0x08, 0x07, 0x0c, 0x0b, 0x09, 0x04, 0x03, 0x05, 0x00, 0x04,
+  0x02, 0x01, 0x0b, 0x03, 0x02, 0x03, 0x0a, 0x06, 0x05, 0x04, 0x0d, 0x0c,
+  0x06, 0x08, 0x09, 0x08, 0x03, 0x07, 0x06, 0x01, 0x01, 0x00, 0x02, 0x01,
+  0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f,
+  0x3c, 0x10, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c,
+  0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59,
+  0x01, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x11, 0x21, 0x03, 0x33,
+  0x35, 0x23, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0x7d, 0x01, 0x77, 0xfa, 0xfa,
+  0xfa, 0x01, 0xf4, 0xfa, 0x7d, 0x7d, 0x02, 0x71, 0xfe, 0x8a, 0xf8, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0xff, 0x83, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x13, 0x00, 0x7e, 0x40, 0x3e, 0x01, 0x14, 0x14, 0x40, 0x15, 0x0b,
+  0x12, 0x11, 0x0e, 0x0d, 0x0a, 0x09, 0x01, 0x07, 0x00, 0x04, 0x10, 0x0f,
+  0x0c, 0x03, 0x0b, 0x13, 0x08, 0x07, 0x04, 0x03, 0x05, 0x02, 0x04, 0x06,
+  0x05, 0x02, 0x01, 0x06, 0x08, 0x0d, 0x0c, 0x05, 0x04, 0x03, 0x05, 0x00,
+  0x06, 0x0f, 0x0e, 0x11, 0x10, 0x13, 0x12, 0x01, 0x09, 0x08, 0x03, 0x0b,
+  0x0a, 0x07, 0x03, 0x06, 0x02, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x05, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x11,
+  0x23, 0x11, 0x15, 0x23, 0x11, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x23,
+  0x15, 0x33, 0x15, 0x23, 0x35, 0x23, 0x01, 0x77, 0xfa, 0x7d, 0x7d, 0xfa,
+  0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7e, 0x01, 0x75, 0xfe, 0x8b, 0x01, 0x01,
+  0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x11, 0x00, 0x7a, 0x40, 0x3b,
+  0x01, 0x12, 0x12, 0x40, 0x13, 0x00, 0x10, 0x0f, 0x0c, 0x0b, 0x08, 0x07,
+  0x02, 0x07, 0x01, 0x04, 0x11, 0x0e, 0x0d, 0x03, 0x00, 0x0a, 0x09, 0x04,
+  0x03, 0x03, 0x04, 0x06, 0x05, 0x0f, 0x0e, 0x0b, 0x03, 0x0a, 0x06, 0x11,
+  0x10, 0x03, 0x03, 0x02, 0x09, 0x08, 0x06, 0x06, 0x0d, 0x0c, 0x02, 0x07,
+  0x06, 0x03, 0x05, 0x04, 0x01, 0x03, 0x00, 0x01, 0x01, 0x05, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
+  0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x12, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x12, 0xff, 0xc0, 0x38, 0x59,
+  0x21, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x21, 0x15, 0x23, 0x15, 0x33,
+  0x35, 0x33, 0x15, 0x23, 0x15, 0x33, 0x01, 0xf4, 0x7d, 0xfa, 0x7d, 0x01,
+  0x77, 0xfa, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7c, 0xfa,
+  0xf9, 0xfa, 0x7d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+  0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+  0x00, 0x80, 0x40, 0x37, 0x01, 0x14, 0x14, 0x40, 0x15, 0x06, 0x13, 0x12,
+  0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0a, 0x09, 0x01, 0x03, 0x00, 0x06,
+  0x03, 0x02, 0x0e, 0x0d, 0x0b, 0x03, 0x08, 0x06, 0x13, 0x10, 0x0f, 0x03,
+  0x0c, 0x07, 0x04, 0x12, 0x11, 0x06, 0x05, 0x02, 0x01, 0x00, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x33,
+  0x35, 0x23, 0x37, 0x15, 0x21, 0x35, 0x03, 0x35, 0x23, 0x15, 0x05, 0x35,
+  0x23, 0x15, 0x21, 0x15, 0x21, 0x35, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d,
+  0xfa, 0x01, 0x77, 0x7d, 0xfe, 0x89, 0x01, 0x77, 0x01, 0x77, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x07,
+  0x00, 0x4e, 0x40, 0x1b, 0x01, 0x08, 0x08, 0x40, 0x09, 0x03, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x05, 0x04, 0x01, 0x00, 0x07, 0x06,
+  0x03, 0x03, 0x02, 0x02, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x3f, 0x17, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x05, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x3b, 0x01, 0x11, 0x33,
+  0x35, 0x21, 0x15, 0x33, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x01, 0xf4,
+  0x7d, 0x7d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x5e, 0x40, 0x25, 0x01, 0x0c,
+  0x0c, 0x40, 0x0d, 0x01, 0x0b, 0x08, 0x07, 0x06, 0x01, 0x00, 0x06, 0x05,
+  0x02, 0x01, 0x0b, 0x0a, 0x03, 0x03, 0x00, 0x05, 0x09, 0x08, 0x07, 0x03,
+  0x04, 0x05, 0x04, 0x03, 0x03, 0x02, 0x0a, 0x09, 0x01, 0x05, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00,
+  0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x33, 0x11, 0x2b, 0x02, 0x11,
+  0x33, 0x31, 0x15, 0x33, 0x35, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x01, 0xf4, 0xfe, 0x0c, 0x7d, 0x7d, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+  0x00, 0x0f, 0x00, 0x71, 0x40, 0x30, 0x01, 0x10, 0x10, 0x40, 0x11, 0x0a,
+  0x0f, 0x0e, 0x0a, 0x09, 0x07, 0x06, 0x05, 0x04, 0x01, 0x00, 0x0b, 0x0a,
+  0x03, 0x00, 0x09, 0x08, 0x06, 0x03, 0x05, 0x05, 0x01, 0x0e, 0x0d, 0x07,
+  0x03, 0x04, 0x04, 0x0f, 0x0c, 0x02, 0x03, 0x01, 0x0b, 0x08, 0x03, 0x03,
+  0x02, 0x0d, 0x0c, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f,
+  0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
+  0x00, 0x00, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
+  0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x35, 0x33, 0x11,
+  0x23, 0x13, 0x33, 0x35, 0x23, 0x37, 0x15, 0x33, 0x35, 0x01, 0x33, 0x35,
+  0x23, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d,
+  0x7d, 0x01, 0xf4, 0xfe, 0x0c, 0xfa, 0xfa, 0xfa, 0xfa, 0xfd, 0x8f, 0x7d,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x84, 0x40, 0x3c,
+  0x01, 0x14, 0x14, 0x40, 0x15, 0x12, 0x12, 0x11, 0x0f, 0x0e, 0x0b, 0x0a,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x13, 0x12, 0x02, 0x01, 0x0b, 0x08,
+  0x03, 0x03, 0x00, 0x04, 0x05, 0x11, 0x10, 0x0e, 0x03, 0x0d, 0x04, 0x04,
+  0x0f, 0x0c, 0x07, 0x03, 0x04, 0x04, 0x0a, 0x09, 0x06, 0x03, 0x05, 0x13,
+  0x10, 0x01, 0x03, 0x00, 0x0d, 0x0c, 0x09, 0x03, 0x08, 0x01, 0x01, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x01,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x01, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23,
+  0x11, 0x33, 0x13, 0x23, 0x11, 0x33, 0x07, 0x33, 0x35, 0x23, 0x17, 0x33,
+  0x35, 0x23, 0x13, 0x11, 0x33, 0x11, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0xfe, 0x0c,
+  0x01, 0x77, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4, 0xfe, 0x0c,
+  0x01, 0xf4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x77,
+  0x40, 0x39, 0x01, 0x14, 0x14, 0x40, 0x15, 0x04, 0x12, 0x11, 0x0e, 0x0d,
+  0x07, 0x04, 0x02, 0x01, 0x13, 0x10, 0x09, 0x08, 0x06, 0x05, 0x05, 0x05,
+  0x0f, 0x0c, 0x0b, 0x0a, 0x03, 0x05, 0x00, 0x13, 0x12, 0x0d, 0x0c, 0x0b,
+  0x05, 0x08, 0x06, 0x0a, 0x09, 0x07, 0x06, 0x03, 0x05, 0x02, 0x05, 0x04,
+  0x01, 0x03, 0x00, 0x11, 0x10, 0x0f, 0x03, 0x0e, 0x01, 0x01, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x01, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13,
+  0x23, 0x15, 0x33, 0x25, 0x23, 0x15, 0x33, 0x07, 0x35, 0x23, 0x15, 0x31,
+  0x23, 0x15, 0x3b, 0x02, 0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x02, 0x71, 0xfa, 0xfa,
+  0xfa, 0x7d, 0x7d, 0x7d, 0xfa, 0xfa, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x6b,
+  0x40, 0x2f, 0x01, 0x10, 0x10, 0x40, 0x11, 0x09, 0x05, 0x04, 0x03, 0x02,
+  0x0a, 0x09, 0x02, 0x01, 0x0f, 0x0e, 0x0b, 0x08, 0x07, 0x05, 0x04, 0x05,
+  0x0d, 0x0c, 0x06, 0x05, 0x03, 0x05, 0x00, 0x07, 0x06, 0x06, 0x0f, 0x0c,
+  0x09, 0x03, 0x08, 0x0b, 0x0a, 0x01, 0x03, 0x00, 0x0e, 0x0d, 0x01, 0x01,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0x2f,
+  0x17, 0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x01, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13,
+  0x23, 0x15, 0x3b, 0x01, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x23, 0x03,
+  0x15, 0x33, 0x35, 0x7d, 0x7d, 0x7d, 0xfa, 0xfa, 0xfa, 0x7d, 0x7d, 0xfa,
+  0xfa, 0x02, 0x71, 0xfa, 0x7d, 0x7d, 0x01, 0xf4, 0xfe, 0x0c, 0x7d, 0x7d,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x05,
+  0x00, 0x09, 0x00, 0x0f, 0x00, 0x72, 0x40, 0x2f, 0x01, 0x10, 0x10, 0x40,
+  0x11, 0x00, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x05, 0x03, 0x04, 0x06,
+  0x02, 0x0e, 0x0d, 0x09, 0x03, 0x08, 0x06, 0x0c, 0x0b, 0x01, 0x00, 0x0f,
+  0x0a, 0x03, 0x02, 0x02, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59,
+  0x01, 0x21, 0x15, 0x33, 0x15, 0x33, 0x2b, 0x01, 0x15, 0x33, 0x17, 0x35,
+  0x23, 0x35, 0x23, 0x15, 0x01, 0x77, 0xfe, 0x89, 0xfa, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d,
+  0xfa, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x71,
+  0x00, 0x07, 0x00, 0x4e, 0x40, 0x1a, 0x01, 0x08, 0x08, 0x40, 0x09, 0x02,
+  0x04, 0x03, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x07, 0x00,
+  0x02, 0x01, 0x06, 0x05, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x00, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x19, 0x01,
+  0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0xfa, 0x7d, 0x7d, 0x02, 0x71, 0xfd,
+  0x8f, 0x7d, 0x01, 0x77, 0x7d, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x71, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+  0x00, 0x13, 0x00, 0x89, 0x40, 0x42, 0x01, 0x14, 0x14, 0x40, 0x15, 0x10,
+  0x06, 0x05, 0x05, 0x04, 0x02, 0x03, 0x01, 0x04, 0x07, 0x06, 0x00, 0x12,
+  0x11, 0x0b, 0x03, 0x08, 0x04, 0x13, 0x10, 0x0f, 0x0c, 0x0a, 0x03, 0x09,
+  0x04, 0x0e, 0x0d, 0x03, 0x03, 0x00, 0x0d, 0x0c, 0x0b, 0x03, 0x0a, 0x06,
+  0x0f, 0x0e, 0x01, 0x03, 0x00, 0x13, 0x12, 0x09, 0x03, 0x08, 0x06, 0x10,
+  0x11, 0x10, 0x01, 0x07, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x06, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0xdd, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xdd, 0x3c,
+  0xfd, 0x17, 0x3c, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
+  0x00, 0x06, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
+  0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x35,
+  0x33, 0x27, 0x15, 0x23, 0x35, 0x01, 0x23, 0x35, 0x33, 0x2b, 0x01, 0x35,
+  0x33, 0x13, 0x23, 0x35, 0x33, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xfe, 0x0c, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x71, 0x00, 0x07, 0x00, 0x4e,
+  0x40, 0x1a, 0x01, 0x08, 0x08, 0x40, 0x09, 0x00, 0x06, 0x05, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x02, 0x01, 0x07, 0x00, 0x04, 0x03,
+  0x02, 0x01, 0x02, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f,
+  0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x02, 0x00,
+  0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9,
+  0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x33, 0x11, 0x23, 0x15, 0x33, 0x11,
+  0x23, 0x15, 0xfa, 0xfa, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0xfe, 0x89, 0x7d,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x77, 0x01, 0x77, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x5f, 0x40, 0x26, 0x01, 0x0c, 0x0c, 0x40,
+  0x0d, 0x09, 0x0b, 0x0a, 0x07, 0x06, 0x0a, 0x09, 0x07, 0x04, 0x0b, 0x08,
+  0x03, 0x03, 0x02, 0x04, 0x06, 0x05, 0x01, 0x03, 0x00, 0x03, 0x00, 0x09,
+  0x08, 0x05, 0x03, 0x04, 0x02, 0x01, 0x02, 0x01, 0x04, 0x46, 0x76, 0x2f,
+  0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x17, 0x3c, 0x2f, 0x3c, 0x01, 0x2f,
+  0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x04, 0x00, 0x0c,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x0c, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x15, 0x33, 0x35, 0x07, 0x33, 0x35,
+  0x23, 0x17, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x7d, 0x00, 0x03, 0x00, 0x3d,
+  0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00,
+  0x03, 0x00, 0x02, 0x01, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30,
+  0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x04, 0x49, 0x68, 0x61, 0xb0,
+  0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x04, 0xff, 0xc0, 0x38,
+  0x59, 0x35, 0x15, 0x21, 0x35, 0x01, 0xf4, 0x7d, 0x7d, 0x7d, 0x00, 0x02,
+  0x00, 0x00, 0x01, 0x77, 0x00, 0xfa, 0x02, 0x71, 0x00, 0x03, 0x00, 0x07,
+  0x00, 0x4e, 0x40, 0x1a, 0x01, 0x08, 0x08, 0x40, 0x09, 0x05, 0x07, 0x06,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x03, 0x00, 0x05, 0x04,
+  0x02, 0x01, 0x02, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x00, 0x00, 0x08, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x08, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x33, 0x35,
+  0x15, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfa,
+  0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4,
+  0x00, 0x03, 0x00, 0x0b, 0x00, 0x65, 0x40, 0x2c, 0x01, 0x0c, 0x0c, 0x40,
+  0x0d, 0x06, 0x02, 0x01, 0x04, 0x07, 0x06, 0x09, 0x08, 0x05, 0x04, 0x03,
+  0x05, 0x00, 0x04, 0x0b, 0x0a, 0x0b, 0x04, 0x03, 0x03, 0x02, 0x06, 0x05,
+  0x0a, 0x09, 0x01, 0x03, 0x00, 0x06, 0x07, 0x08, 0x07, 0x01, 0x06, 0x05,
+  0x02, 0x01, 0x0a, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f,
+  0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c,
+  0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x0a, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x37,
+  0x33, 0x35, 0x23, 0x3d, 0x01, 0x21, 0x11, 0x21, 0x35, 0x23, 0x35, 0x7d,
+  0xfa, 0xfa, 0x01, 0x77, 0xfe, 0x89, 0x7d, 0x7e, 0xf8, 0x01, 0x7d, 0xfe,
+  0x0c, 0x7d, 0xfa, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+  0x02, 0x71, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x6e, 0x40, 0x32, 0x01, 0x0e,
+  0x0e, 0x40, 0x0f, 0x01, 0x0d, 0x0a, 0x08, 0x03, 0x07, 0x04, 0x06, 0x05,
+  0x0c, 0x0b, 0x09, 0x04, 0x03, 0x05, 0x00, 0x04, 0x02, 0x01, 0x0b, 0x03,
+  0x02, 0x03, 0x0a, 0x06, 0x04, 0x0d, 0x01, 0x00, 0x03, 0x0c, 0x06, 0x08,
+  0x09, 0x08, 0x02, 0x07, 0x06, 0x03, 0x05, 0x04, 0x01, 0x01, 0x05, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17,
+  0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x05, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x33,
+  0x15, 0x23, 0x15, 0x21, 0x11, 0x33, 0x15, 0x33, 0x03, 0x33, 0x35, 0x23,
+  0x01, 0x77, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0xfa, 0xfa, 0xfa, 0xfa, 0x01,
+  0x77, 0xfa, 0x7d, 0x02, 0x71, 0x7d, 0xfe, 0x8a, 0xf8, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07,
+  0x00, 0x0b, 0x00, 0x5e, 0x40, 0x24, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00,
+  0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x0a, 0x09, 0x07, 0x03, 0x06, 0x07, 0x05, 0x04, 0x03, 0x03, 0x00, 0x02,
+  0x01, 0x0b, 0x08, 0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f,
+  0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x0c, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0,
+  0x38, 0x59, 0x01, 0x35, 0x23, 0x15, 0x31, 0x23, 0x15, 0x33, 0x17, 0x35,
+  0x23, 0x15, 0x01, 0x77, 0xfa, 0x7d, 0x7d, 0xfa, 0xfa, 0x01, 0x77, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xf4, 0x02, 0x71, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x6e, 0x40, 0x32,
+  0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x08, 0x07, 0x06, 0x02, 0x03, 0x01, 0x04,
+  0x09, 0x08, 0x0b, 0x0a, 0x05, 0x04, 0x03, 0x05, 0x00, 0x04, 0x0d, 0x0c,
+  0x0d, 0x04, 0x03, 0x03, 0x02, 0x06, 0x05, 0x0c, 0x0b, 0x01, 0x03, 0x00,
+  0x06, 0x09, 0x0a, 0x09, 0x01, 0x08, 0x07, 0x03, 0x06, 0x05, 0x02, 0x01,
+  0x0c, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f,
+  0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c,
+  0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01,
+  0x49, 0x68, 0xb9, 0x00, 0x0c, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40,
+  0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59,
+  0x37, 0x33, 0x35, 0x23, 0x3d, 0x01, 0x33, 0x35, 0x33, 0x11, 0x21, 0x35,
+  0x23, 0x35, 0x7d, 0xfa, 0xfa, 0xfa, 0x7d, 0xfe, 0x89, 0x7d, 0x7e, 0xf8,
+  0x01, 0x7d, 0x7d, 0xfd, 0x8f, 0x7d, 0xfa, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x11, 0x00, 0x81,
+  0x40, 0x3f, 0x01, 0x12, 0x12, 0x40, 0x13, 0x0c, 0x0d, 0x0c, 0x05, 0x00,
+  0x11, 0x10, 0x0b, 0x03, 0x0a, 0x05, 0x02, 0x0f, 0x0e, 0x01, 0x03, 0x00,
+  0x05, 0x06, 0x09, 0x08, 0x05, 0x04, 0x03, 0x05, 0x02, 0x04, 0x07, 0x06,
+  0x0e, 0x03, 0x00, 0x03, 0x0d, 0x06, 0x0c, 0x0b, 0x08, 0x02, 0x01, 0x05,
+  0x07, 0x10, 0x0f, 0x06, 0x03, 0x05, 0x06, 0x04, 0x0a, 0x09, 0x02, 0x11,
+  0x04, 0x01, 0x01, 0x06, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
+  0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c,
+  0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
+  0x00, 0x06, 0x00, 0x12, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
+  0x11, 0x37, 0xb9, 0x00, 0x12, 0xff, 0xc0, 0x38, 0x59, 0x37, 0x35, 0x23,
+  0x1d, 0x01, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
+  0x15, 0x33, 0x15, 0xfa, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0xfa, 0x7d, 0xfb,
+  0x7b, 0x7b, 0xfb, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x03, 0x00, 0x0f,
+  0x00, 0x71, 0x40, 0x2d, 0x01, 0x10, 0x10, 0x40, 0x11, 0x00, 0x0f, 0x0c,
+  0x0b, 0x08, 0x07, 0x04, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0e, 0x0d, 0x06, 0x03,
+  0x05, 0x06, 0x02, 0x01, 0x00, 0x0a, 0x09, 0x03, 0x02, 0x02, 0x01, 0x06,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x06,
+  0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x33, 0x23,
+  0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x01,
+  0x77, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d,
+  0x7d, 0x7d, 0xfa, 0xfa, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00, 0xff, 0x06,
+  0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x11, 0x00, 0x7d, 0x40, 0x3d,
+  0x01, 0x12, 0x12, 0x40, 0x13, 0x0d, 0x10, 0x0f, 0x06, 0x05, 0x02, 0x05,
+  0x01, 0x04, 0x0e, 0x0d, 0x11, 0x0c, 0x0b, 0x08, 0x07, 0x04, 0x03, 0x07,
+  0x00, 0x04, 0x0a, 0x09, 0x0b, 0x0a, 0x03, 0x03, 0x02, 0x06, 0x0c, 0x09,
+  0x08, 0x01, 0x03, 0x00, 0x06, 0x06, 0x0f, 0x0e, 0x05, 0x03, 0x04, 0x06,
+  0x10, 0x11, 0x10, 0x00, 0x0d, 0x0c, 0x02, 0x07, 0x06, 0x01, 0x01, 0x09,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
+  0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00,
+  0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09, 0x00, 0x12, 0x49, 0x68,
+  0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x12, 0xff,
+  0xc0, 0x38, 0x59, 0x37, 0x33, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x35,
+  0x23, 0x35, 0x33, 0x35, 0x21, 0x11, 0x23, 0x15, 0x23, 0x7d, 0xfa, 0xfa,
+  0xfa, 0xfa, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0xfa, 0x7e, 0xf8, 0xfe, 0x0d,
+  0x7d, 0x7d, 0xfa, 0x7d, 0xfd, 0x8f, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x5e,
+  0x40, 0x25, 0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x09, 0x0b, 0x0a, 0x07, 0x06,
+  0x05, 0x00, 0x0a, 0x09, 0x03, 0x02, 0x0b, 0x08, 0x07, 0x03, 0x06, 0x05,
+  0x05, 0x04, 0x01, 0x03, 0x00, 0x02, 0x01, 0x09, 0x08, 0x04, 0x03, 0x03,
+  0x01, 0x02, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f,
+  0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x02, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x35,
+  0x23, 0x11, 0x33, 0x11, 0x33, 0x35, 0x11, 0x33, 0x11, 0x23, 0x7d, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0xf4, 0x7d, 0xfd, 0x8f, 0x01, 0x77, 0x7d,
+  0xfe, 0x0c, 0x01, 0x77, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
+  0x02, 0x71, 0x00, 0x03, 0x00, 0x07, 0x00, 0x51, 0x40, 0x1c, 0x01, 0x08,
+  0x08, 0x40, 0x09, 0x00, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+  0x05, 0x04, 0x06, 0x02, 0x01, 0x00, 0x07, 0x06, 0x03, 0x02, 0x02, 0x01,
+  0x01, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f,
+  0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x08,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x08, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33, 0x15, 0x23, 0x11,
+  0x33, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfe, 0x89,
+  0x00, 0x03, 0x00, 0x00, 0xff, 0x06, 0x00, 0xfa, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x61, 0x40, 0x24, 0x01, 0x0c, 0x0c, 0x40,
+  0x0d, 0x00, 0x09, 0x08, 0x07, 0x06, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x05, 0x04, 0x06, 0x02, 0x01, 0x00,
+  0x0b, 0x0a, 0x03, 0x02, 0x02, 0x01, 0x09, 0x46, 0x76, 0x2f, 0x37, 0x18,
+  0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x09,
+  0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37,
+  0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33, 0x15,
+  0x23, 0x11, 0x33, 0x2b, 0x01, 0x15, 0x33, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfe, 0x0c, 0x7d, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x09, 0x00, 0x0d,
+  0x00, 0x11, 0x00, 0x78, 0x40, 0x36, 0x01, 0x12, 0x12, 0x40, 0x13, 0x0a,
+  0x0b, 0x0a, 0x03, 0x02, 0x0f, 0x0e, 0x0d, 0x0a, 0x06, 0x05, 0x11, 0x10,
+  0x0c, 0x0b, 0x09, 0x05, 0x00, 0x05, 0x03, 0x02, 0x01, 0x04, 0x08, 0x07,
+  0x04, 0x03, 0x03, 0x0d, 0x0c, 0x01, 0x03, 0x00, 0x07, 0x10, 0x0f, 0x09,
+  0x03, 0x08, 0x05, 0x04, 0x11, 0x0e, 0x07, 0x03, 0x06, 0x01, 0x05, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x3c, 0x2f, 0x17,
+  0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x05, 0x00, 0x12, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x12,
+  0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x23, 0x11, 0x23, 0x11, 0x33,
+  0x35, 0x33, 0x13, 0x23, 0x15, 0x33, 0x11, 0x35, 0x23, 0x15, 0x01, 0x77,
+  0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d,
+  0x01, 0x77, 0xfd, 0x8f, 0x7d, 0x01, 0x77, 0x7d, 0xfe, 0x89, 0x7d, 0x7d,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x02, 0x71, 0x00, 0x03,
+  0x00, 0x3d, 0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x00, 0x03, 0x02,
+  0x01, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x00,
+  0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x04, 0x49, 0x68,
+  0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x04, 0xff,
+  0xc0, 0x38, 0x59, 0x13, 0x23, 0x11, 0x33, 0x7d, 0x7d, 0x7d, 0x02, 0x71,
+  0xfd, 0x8f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x01, 0xf4,
+  0x00, 0x09, 0x00, 0x0d, 0x00, 0x65, 0x40, 0x29, 0x01, 0x0e, 0x0e, 0x40,
+  0x0f, 0x0b, 0x0d, 0x0c, 0x08, 0x07, 0x04, 0x03, 0x0c, 0x0b, 0x01, 0x00,
+  0x05, 0x04, 0x04, 0x03, 0x02, 0x07, 0x06, 0x04, 0x0d, 0x0a, 0x09, 0x03,
+  0x08, 0x09, 0x00, 0x0b, 0x0a, 0x06, 0x05, 0x02, 0x05, 0x01, 0x01, 0x00,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x3c, 0x01,
+  0x2f, 0x17, 0x3c, 0xfd, 0x3c, 0x2f, 0x3c, 0xfd, 0x3c, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x00, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x19,
+  0x01, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x35, 0x11, 0x33, 0x11,
+  0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4, 0xfe, 0x0c, 0x01,
+  0x77, 0xfe, 0x89, 0x01, 0x77, 0x7d, 0xfe, 0x0c, 0x01, 0x77, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x09,
+  0x00, 0x56, 0x40, 0x20, 0x01, 0x0a, 0x0a, 0x40, 0x0b, 0x01, 0x05, 0x04,
+  0x03, 0x02, 0x08, 0x07, 0x02, 0x01, 0x06, 0x05, 0x03, 0x03, 0x00, 0x05,
+  0x09, 0x04, 0x07, 0x06, 0x09, 0x08, 0x01, 0x03, 0x00, 0x01, 0x07, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x3c, 0x01, 0x2f,
+  0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x0a, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0a,
+  0xff, 0xc0, 0x38, 0x59, 0x21, 0x33, 0x11, 0x2b, 0x01, 0x33, 0x35, 0x21,
+  0x11, 0x33, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0xfa, 0xfe, 0x89, 0x7d, 0x01,
+  0x77, 0x7d, 0xfe, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+  0x01, 0xf4, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x6f, 0x40, 0x35, 0x01, 0x10,
+  0x10, 0x40, 0x11, 0x0b, 0x0e, 0x0d, 0x0a, 0x09, 0x01, 0x05, 0x00, 0x04,
+  0x0c, 0x0b, 0x0f, 0x08, 0x07, 0x04, 0x03, 0x05, 0x02, 0x04, 0x06, 0x05,
+  0x0b, 0x0a, 0x07, 0x06, 0x02, 0x05, 0x01, 0x06, 0x08, 0x0d, 0x0c, 0x05,
+  0x04, 0x03, 0x05, 0x00, 0x06, 0x0e, 0x0f, 0x0e, 0x01, 0x09, 0x08, 0x02,
+  0x01, 0x05, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd,
+  0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x05, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x25,
+  0x35, 0x23, 0x1d, 0x01, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
+  0x23, 0x15, 0x23, 0x01, 0x77, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa,
+  0x7e, 0xf8, 0xf8, 0x01, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0xff, 0x06, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x09, 0x00, 0x0d,
+  0x00, 0x6e, 0x40, 0x32, 0x01, 0x0e, 0x0e, 0x40, 0x0f, 0x01, 0x0d, 0x0a,
+  0x06, 0x03, 0x05, 0x04, 0x08, 0x07, 0x0c, 0x0b, 0x09, 0x04, 0x03, 0x05,
+  0x00, 0x04, 0x02, 0x01, 0x0b, 0x03, 0x02, 0x03, 0x0a, 0x06, 0x04, 0x0d,
+  0x01, 0x00, 0x03, 0x0c, 0x06, 0x08, 0x09, 0x08, 0x02, 0x07, 0x06, 0x00,
+  0x05, 0x04, 0x01, 0x01, 0x07, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f,
+  0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17,
+  0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c,
+  0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x0e, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e,
+  0xff, 0xc0, 0x38, 0x59, 0x01, 0x33, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23,
+  0x11, 0x21, 0x03, 0x33, 0x35, 0x23, 0x01, 0x77, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x01, 0x77, 0xfa, 0xfa, 0xfa, 0x01, 0x77, 0xfa, 0x7d, 0xfa, 0x02, 0xee,
+  0xfe, 0x8a, 0xf8, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0x06, 0x01, 0xf4,
+  0x01, 0xf4, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x6e, 0x40, 0x32, 0x01, 0x0e,
+  0x0e, 0x40, 0x0f, 0x06, 0x09, 0x08, 0x02, 0x03, 0x01, 0x04, 0x07, 0x06,
+  0x0b, 0x0a, 0x05, 0x04, 0x03, 0x05, 0x00, 0x04, 0x0d, 0x0c, 0x0d, 0x04,
+  0x03, 0x03, 0x02, 0x06, 0x05, 0x0c, 0x0b, 0x01, 0x03, 0x00, 0x06, 0x09,
+  0x0a, 0x09, 0x01, 0x08, 0x07, 0x00, 0x06, 0x05, 0x02, 0x01, 0x0c, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c, 0x3f, 0x3c, 0x3f, 0x3c, 0x10,
+  0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x3c, 0xfd, 0x17,
+  0x3c, 0x2f, 0x3c, 0xfd, 0x17, 0x3c, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x0c, 0x00, 0x0e, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x0e, 0xff, 0xc0, 0x38, 0x59, 0x37, 0x33,
+  0x35, 0x23, 0x3d, 0x01, 0x21, 0x11, 0x23, 0x35, 0x23, 0x35, 0x23, 0x35,
+  0x7d, 0xfa, 0xfa, 0x01, 0x77, 0x7d, 0xfa, 0x7d, 0x7e, 0xf8, 0x01, 0x7d,
+  0xfd, 0x12, 0xfa, 0x7d, 0xfa, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x77, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x5e, 0x40, 0x25,
+  0x01, 0x0c, 0x0c, 0x40, 0x0d, 0x00, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02,
+  0x0a, 0x09, 0x03, 0x00, 0x06, 0x05, 0x02, 0x03, 0x01, 0x04, 0x0b, 0x08,
+  0x07, 0x03, 0x04, 0x09, 0x08, 0x01, 0x03, 0x00, 0x0b, 0x0a, 0x01, 0x09,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0x01,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x09, 0x00, 0x0c, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x0c, 0xff, 0xc0, 0x38, 0x59, 0x01, 0x23, 0x15, 0x33,
+  0x07, 0x33, 0x35, 0x23, 0x35, 0x23, 0x11, 0x33, 0x01, 0x77, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe,
+  0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4,
+  0x00, 0x07, 0x00, 0x0f, 0x00, 0x71, 0x40, 0x2f, 0x01, 0x10, 0x10, 0x40,
+  0x11, 0x06, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
+  0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x06, 0x05, 0x02, 0x03, 0x01, 0x06,
+  0x03, 0x0e, 0x0d, 0x04, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x0b, 0x03, 0x08,
+  0x07, 0x00, 0x0a, 0x09, 0x01, 0x02, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00,
+  0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x02, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13,
+  0x15, 0x23, 0x15, 0x33, 0x35, 0x33, 0x35, 0x01, 0x15, 0x21, 0x35, 0x33,
+  0x35, 0x23, 0x15, 0x7d, 0x7d, 0xfa, 0xfa, 0xfe, 0x0c, 0x01, 0x77, 0x7d,
+  0xfa, 0x01, 0xf4, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71,
+  0x00, 0x0b, 0x00, 0x0f, 0x00, 0x6e, 0x40, 0x2c, 0x01, 0x10, 0x10, 0x40,
+  0x11, 0x09, 0x0b, 0x0a, 0x03, 0x02, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a,
+  0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x09, 0x08,
+  0x05, 0x03, 0x04, 0x07, 0x0e, 0x0d, 0x07, 0x03, 0x06, 0x01, 0x00, 0x0f,
+  0x0c, 0x01, 0x03, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f,
+  0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x03, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x23,
+  0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x13, 0x35, 0x23, 0x15,
+  0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d,
+  0x7d, 0xfa, 0xfa, 0x7d, 0xfe, 0x0c, 0x7d, 0x7d, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x05, 0x00, 0x09, 0x00, 0x56,
+  0x40, 0x20, 0x01, 0x0a, 0x0a, 0x40, 0x0b, 0x03, 0x09, 0x08, 0x01, 0x00,
+  0x08, 0x07, 0x04, 0x03, 0x05, 0x00, 0x05, 0x09, 0x06, 0x02, 0x03, 0x01,
+  0x07, 0x06, 0x05, 0x03, 0x04, 0x03, 0x02, 0x01, 0x07, 0x46, 0x76, 0x2f,
+  0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c,
+  0xfd, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x07, 0x00, 0x0a, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x0a, 0xff, 0xc0,
+  0x38, 0x59, 0x25, 0x23, 0x15, 0x21, 0x11, 0x2b, 0x02, 0x11, 0x33, 0x01,
+  0x77, 0xfa, 0x01, 0x77, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x01, 0xf4,
+  0xfe, 0x89, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4,
+  0x00, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x73, 0x40, 0x32,
+  0x01, 0x12, 0x12, 0x40, 0x13, 0x01, 0x11, 0x10, 0x0d, 0x0c, 0x0b, 0x0a,
+  0x08, 0x07, 0x01, 0x00, 0x07, 0x06, 0x02, 0x01, 0x10, 0x0f, 0x0d, 0x03,
+  0x0a, 0x04, 0x04, 0x0c, 0x0b, 0x03, 0x03, 0x00, 0x05, 0x11, 0x0e, 0x09,
+  0x08, 0x05, 0x05, 0x04, 0x06, 0x05, 0x03, 0x03, 0x02, 0x0f, 0x0e, 0x01,
+  0x06, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c,
+  0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x06, 0x00, 0x12,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x12, 0xff, 0xc0, 0x38, 0x59, 0x25, 0x33, 0x35, 0x23, 0x07, 0x35, 0x23,
+  0x11, 0x33, 0x35, 0x17, 0x33, 0x35, 0x23, 0x07, 0x33, 0x35, 0x23, 0x01,
+  0x77, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xfa, 0xfa, 0xfa, 0xfa, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x01, 0xf4, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x82, 0x40, 0x3c,
+  0x01, 0x14, 0x14, 0x40, 0x15, 0x05, 0x13, 0x12, 0x0f, 0x0e, 0x0b, 0x0a,
+  0x05, 0x04, 0x03, 0x02, 0x06, 0x05, 0x02, 0x01, 0x0f, 0x0c, 0x03, 0x03,
+  0x00, 0x04, 0x09, 0x12, 0x11, 0x07, 0x03, 0x04, 0x04, 0x08, 0x13, 0x10,
+  0x0b, 0x03, 0x08, 0x04, 0x0e, 0x0d, 0x0a, 0x03, 0x09, 0x09, 0x08, 0x07,
+  0x06, 0x01, 0x05, 0x00, 0x11, 0x10, 0x0d, 0x03, 0x0c, 0x01, 0x01, 0x46,
+  0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x01,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00,
+  0x01, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11,
+  0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x23, 0x15, 0x33,
+  0x21, 0x33, 0x35, 0x2b, 0x02, 0x15, 0x33, 0x07, 0x33, 0x35, 0x23, 0x17,
+  0x33, 0x35, 0x23, 0x7d, 0x7d, 0x7d, 0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x01, 0xf4, 0xfa, 0xfa, 0xfa,
+  0xfa, 0xfa, 0xfa, 0xfa, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77,
+  0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+  0x00, 0x77, 0x40, 0x39, 0x01, 0x14, 0x14, 0x40, 0x15, 0x04, 0x11, 0x10,
+  0x0e, 0x0d, 0x07, 0x04, 0x01, 0x00, 0x13, 0x12, 0x0b, 0x08, 0x06, 0x05,
+  0x05, 0x04, 0x0f, 0x0c, 0x0a, 0x09, 0x03, 0x05, 0x02, 0x09, 0x08, 0x07,
+  0x06, 0x02, 0x05, 0x01, 0x07, 0x12, 0x11, 0x0d, 0x0c, 0x0b, 0x05, 0x0a,
+  0x05, 0x04, 0x03, 0x03, 0x00, 0x13, 0x10, 0x0f, 0x03, 0x0e, 0x01, 0x00,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x17, 0x3c, 0x2f, 0x17, 0x3c,
+  0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17,
+  0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30,
+  0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x14, 0x49, 0x68, 0x61, 0xb0,
+  0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x14, 0xff, 0xc0, 0x38,
+  0x59, 0x11, 0x15, 0x33, 0x35, 0x33, 0x23, 0x15, 0x33, 0x2b, 0x01, 0x15,
+  0x33, 0x2b, 0x01, 0x15, 0x3b, 0x01, 0x35, 0x23, 0x15, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x01, 0xf4, 0x7d,
+  0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0x7d, 0x00, 0x03, 0x00, 0x00, 0xff, 0x06,
+  0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x6b,
+  0x40, 0x2f, 0x01, 0x10, 0x10, 0x40, 0x11, 0x06, 0x0a, 0x09, 0x03, 0x02,
+  0x07, 0x06, 0x02, 0x01, 0x0d, 0x0c, 0x0b, 0x0a, 0x03, 0x05, 0x00, 0x05,
+  0x0f, 0x0e, 0x09, 0x08, 0x05, 0x05, 0x04, 0x0b, 0x04, 0x06, 0x0f, 0x0c,
+  0x06, 0x03, 0x05, 0x08, 0x07, 0x01, 0x03, 0x00, 0x0e, 0x0d, 0x01, 0x01,
+  0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0x2f,
+  0x17, 0x3c, 0xfd, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e, 0x2e, 0x31, 0x30, 0x01, 0x49,
+  0x68, 0xb9, 0x00, 0x01, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52,
+  0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13,
+  0x23, 0x11, 0x33, 0x17, 0x15, 0x33, 0x11, 0x23, 0x11, 0x23, 0x1d, 0x02,
+  0x33, 0x35, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d, 0x7d, 0xfa, 0xfa, 0x01, 0xf4,
+  0xfe, 0x89, 0x7d, 0x7d, 0x02, 0x71, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x07,
+  0x00, 0x0f, 0x00, 0x71, 0x40, 0x2f, 0x01, 0x10, 0x10, 0x40, 0x11, 0x06,
+  0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
+  0x03, 0x02, 0x01, 0x00, 0x0d, 0x0c, 0x09, 0x03, 0x08, 0x06, 0x03, 0x0f,
+  0x0e, 0x04, 0x03, 0x03, 0x06, 0x06, 0x05, 0x02, 0x03, 0x01, 0x07, 0x00,
+  0x0b, 0x0a, 0x01, 0x00, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c,
+  0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd, 0x17, 0x3c,
+  0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9,
+  0x00, 0x00, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38,
+  0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x11, 0x15, 0x33,
+  0x15, 0x33, 0x35, 0x33, 0x35, 0x01, 0x23, 0x15, 0x21, 0x35, 0x23, 0x35,
+  0x23, 0xfa, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x01, 0xf4, 0xfa, 0x7d, 0x01,
+  0xf4, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71, 0x00, 0x05, 0x00, 0x09,
+  0x00, 0x0f, 0x00, 0x72, 0x40, 0x2f, 0x01, 0x10, 0x10, 0x40, 0x11, 0x04,
+  0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
+  0x03, 0x02, 0x01, 0x00, 0x0d, 0x0c, 0x09, 0x06, 0x09, 0x08, 0x02, 0x03,
+  0x01, 0x06, 0x0f, 0x0e, 0x07, 0x03, 0x06, 0x05, 0x00, 0x0b, 0x0a, 0x04,
+  0x03, 0x02, 0x01, 0x06, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x3c,
+  0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c, 0x10, 0xfd,
+  0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68,
+  0xb9, 0x00, 0x06, 0x00, 0x10, 0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58,
+  0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0, 0x38, 0x59, 0x13, 0x15,
+  0x33, 0x35, 0x33, 0x35, 0x01, 0x33, 0x35, 0x23, 0x13, 0x33, 0x35, 0x23,
+  0x35, 0x23, 0x7d, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x02, 0x71, 0xfa, 0x7d, 0x7d, 0xfe, 0x89, 0x7d, 0xfe, 0x89, 0x7d,
+  0x7d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x3d, 0x40, 0x11, 0x01, 0x04, 0x04, 0x40, 0x05, 0x01,
+  0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x01, 0x00, 0x46, 0x76,
+  0x2f, 0x37, 0x18, 0x00, 0x2f, 0x3c, 0x2f, 0x3c, 0x01, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x00, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x04,
+  0x49, 0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00,
+  0x04, 0xff, 0xc0, 0x38, 0x59, 0x31, 0x33, 0x11, 0x23, 0x7d, 0x7d, 0x02,
+  0x71, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x02, 0x71,
+  0x00, 0x05, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x72, 0x40, 0x2f, 0x01, 0x10,
+  0x10, 0x40, 0x11, 0x0d, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
+  0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x07, 0x06, 0x09, 0x0a,
+  0x0f, 0x0e, 0x05, 0x03, 0x04, 0x06, 0x0d, 0x0c, 0x0b, 0x03, 0x0a, 0x01,
+  0x00, 0x09, 0x08, 0x03, 0x02, 0x02, 0x01, 0x01, 0x46, 0x76, 0x2f, 0x37,
+  0x18, 0x00, 0x3f, 0x3c, 0x2f, 0x3c, 0x2f, 0x3c, 0x2f, 0x17, 0x3c, 0xfd,
+  0x17, 0x3c, 0x10, 0xfd, 0x3c, 0x01, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x31,
+  0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x01, 0x00, 0x10, 0x49, 0x68, 0x61,
+  0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10, 0xff, 0xc0,
+  0x38, 0x59, 0x13, 0x23, 0x15, 0x33, 0x15, 0x33, 0x07, 0x23, 0x15, 0x33,
+  0x35, 0x23, 0x3b, 0x01, 0x35, 0x23, 0xfa, 0xfa, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d, 0xfa, 0x7d, 0xfa,
+  0x7d, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x77, 0x01, 0xf4, 0x02, 0x71,
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x72, 0x40, 0x33,
+  0x01, 0x10, 0x10, 0x40, 0x11, 0x09, 0x0f, 0x0e, 0x07, 0x06, 0x0a, 0x09,
+  0x07, 0x04, 0x0e, 0x0d, 0x0b, 0x03, 0x08, 0x04, 0x02, 0x0f, 0x0c, 0x03,
+  0x03, 0x02, 0x04, 0x06, 0x05, 0x01, 0x03, 0x00, 0x0b, 0x0a, 0x03, 0x03,
+  0x00, 0x0d, 0x0c, 0x05, 0x03, 0x04, 0x09, 0x08, 0x02, 0x03, 0x01, 0x02,
+  0x01, 0x04, 0x46, 0x76, 0x2f, 0x37, 0x18, 0x00, 0x3f, 0x17, 0x3c, 0x2f,
+  0x17, 0x3c, 0x2f, 0x17, 0x3c, 0x01, 0x2f, 0x17, 0x3c, 0xfd, 0x17, 0x3c,
+  0x10, 0xfd, 0x17, 0x3c, 0x2e, 0x2e, 0x2e, 0x2e, 0x00, 0x2e, 0x2e, 0x2e,
+  0x2e, 0x31, 0x30, 0x01, 0x49, 0x68, 0xb9, 0x00, 0x04, 0x00, 0x10, 0x49,
+  0x68, 0x61, 0xb0, 0x40, 0x52, 0x58, 0x38, 0x11, 0x37, 0xb9, 0x00, 0x10,
+  0xff, 0xc0, 0x38, 0x59, 0x13, 0x15, 0x33, 0x35, 0x07, 0x33, 0x35, 0x23,
+  0x21, 0x33, 0x35, 0x23, 0x07, 0x33, 0x35, 0x23, 0x7d, 0x7d, 0xfa, 0x7d,
+  0x7d, 0x01, 0x77, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x71, 0x7d, 0x7d,
+  0xfa, 0x7d, 0x7d, 0xfa, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x01, 0x5e,
+  0x00, 0x00, 0x02, 0x5a, 0x00, 0x00, 0x03, 0x26, 0x00, 0x00, 0x03, 0xec,
+  0x00, 0x00, 0x04, 0xe2, 0x00, 0x00, 0x05, 0x38, 0x00, 0x00, 0x05, 0xc4,
+  0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x07, 0x94,
+  0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x5a, 0x00, 0x00, 0x08, 0xac,
+  0x00, 0x00, 0x09, 0x72, 0x00, 0x00, 0x0a, 0x1a, 0x00, 0x00, 0x0a, 0x7c,
+  0x00, 0x00, 0x0b, 0x36, 0x00, 0x00, 0x0b, 0xfc, 0x00, 0x00, 0x0c, 0xb0,
+  0x00, 0x00, 0x0d, 0x5e, 0x00, 0x00, 0x0e, 0x1a, 0x00, 0x00, 0x0e, 0xba,
+  0x00, 0x00, 0x0f, 0xa4, 0x00, 0x00, 0x10, 0x68, 0x00, 0x00, 0x10, 0xd8,
+  0x00, 0x00, 0x11, 0x48, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x12, 0x86,
+  0x00, 0x00, 0x13, 0x4c, 0x00, 0x00, 0x13, 0xf8, 0x00, 0x00, 0x14, 0xcc,
+  0x00, 0x00, 0x15, 0x74, 0x00, 0x00, 0x16, 0x3e, 0x00, 0x00, 0x16, 0xca,
+  0x00, 0x00, 0x17, 0x62, 0x00, 0x00, 0x17, 0xee, 0x00, 0x00, 0x18, 0x6c,
+  0x00, 0x00, 0x19, 0x1c, 0x00, 0x00, 0x19, 0xa6, 0x00, 0x00, 0x1a, 0x30,
+  0x00, 0x00, 0x1a, 0xcc, 0x00, 0x00, 0x1b, 0xaa, 0x00, 0x00, 0x1c, 0x0c,
+  0x00, 0x00, 0x1c, 0xd2, 0x00, 0x00, 0x1d, 0x78, 0x00, 0x00, 0x1e, 0x20,
+  0x00, 0x00, 0x1e, 0xc0, 0x00, 0x00, 0x1f, 0x7c, 0x00, 0x00, 0x20, 0x2c,
+  0x00, 0x00, 0x20, 0xf4, 0x00, 0x00, 0x21, 0x62, 0x00, 0x00, 0x21, 0xec,
+  0x00, 0x00, 0x22, 0x98, 0x00, 0x00, 0x23, 0x66, 0x00, 0x00, 0x24, 0x1e,
+  0x00, 0x00, 0x24, 0xc0, 0x00, 0x00, 0x25, 0x6a, 0x00, 0x00, 0x25, 0xda,
+  0x00, 0x00, 0x26, 0xaa, 0x00, 0x00, 0x27, 0x18, 0x00, 0x00, 0x27, 0xa6,
+  0x00, 0x00, 0x27, 0xfa, 0x00, 0x00, 0x28, 0x6a, 0x00, 0x00, 0x28, 0xfc,
+  0x00, 0x00, 0x29, 0x9e, 0x00, 0x00, 0x2a, 0x2a, 0x00, 0x00, 0x2a, 0xc8,
+  0x00, 0x00, 0x2b, 0x7e, 0x00, 0x00, 0x2c, 0x22, 0x00, 0x00, 0x2c, 0xd8,
+  0x00, 0x00, 0x2d, 0x64, 0x00, 0x00, 0x2d, 0xd8, 0x00, 0x00, 0x2e, 0x66,
+  0x00, 0x00, 0x2f, 0x1c, 0x00, 0x00, 0x2f, 0x72, 0x00, 0x00, 0x30, 0x0a,
+  0x00, 0x00, 0x30, 0x88, 0x00, 0x00, 0x31, 0x2a, 0x00, 0x00, 0x31, 0xcc,
+  0x00, 0x00, 0x32, 0x6a, 0x00, 0x00, 0x32, 0xf6, 0x00, 0x00, 0x33, 0x9e,
+  0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x34, 0xbe, 0x00, 0x00, 0x35, 0x70,
+  0x00, 0x00, 0x36, 0x34, 0x00, 0x00, 0x36, 0xea, 0x00, 0x00, 0x37, 0x8c,
+  0x00, 0x00, 0x38, 0x32, 0x00, 0x00, 0x38, 0xde, 0x00, 0x00, 0x39, 0x32,
+  0x00, 0x00, 0x39, 0xda, 0x00, 0x00, 0x3a, 0x86, 0x00, 0x00, 0x3a, 0x86,
+  0x01, 0xf4, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00,
+  0x01, 0x77, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x01, 0x77, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00,
+  0x00, 0xfa, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x01, 0x77, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0xee, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00,
+  0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00,
+  0x01, 0xf4, 0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x00, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+  0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c,
+  0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
+  0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
+  0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
+  0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
+  0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
+  0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
+  0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
+  0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c,
+  0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
+  0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
+  0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
+  0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
+  0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
+  0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60,
+  0x00, 0x61, 0x00, 0xac, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x01, 0x06,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x04,
+  0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+  0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c,
+  0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34,
+  0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40,
+  0x41, 0x42, 0x00, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+  0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+  0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf4,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7e,
+  0x00, 0xa0, 0x20, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa0,
+  0x20, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x08, 0x00, 0xc4, 0x00, 0xc4, 0xff, 0xff, 0x00, 0x03, 0x00, 0x04,
+  0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
+  0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
+  0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
+  0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
+  0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
+  0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
+  0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
+  0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
+  0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
+  0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40,
+  0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
+  0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c,
+  0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
+  0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
+  0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e,
+  0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x68, 0x09, 0x07, 0x05, 0x00,
+  0x05, 0x05, 0x02, 0x05, 0x07, 0x06, 0x07, 0x07, 0x02, 0x03, 0x03, 0x05,
+  0x05, 0x03, 0x05, 0x02, 0x07, 0x06, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x02, 0x02, 0x05, 0x05, 0x05, 0x06, 0x07, 0x06, 0x06,
+  0x05, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x07, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x05,
+  0x03, 0x07, 0x03, 0x05, 0x06, 0x03, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05,
+  0x06, 0x06, 0x02, 0x03, 0x06, 0x02, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x06, 0x07, 0x05, 0x06, 0x06, 0x05, 0x02, 0x05, 0x06,
+  0x05, 0x00, 0x00, 0x00, 0x0a, 0x08, 0x05, 0x00, 0x05, 0x05, 0x03, 0x05,
+  0x08, 0x06, 0x08, 0x08, 0x03, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x03,
+  0x08, 0x06, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03,
+  0x03, 0x05, 0x05, 0x05, 0x06, 0x08, 0x06, 0x06, 0x05, 0x06, 0x05, 0x05,
+  0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x08, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x05, 0x06, 0x06, 0x08, 0x06, 0x06, 0x05, 0x04, 0x08, 0x04, 0x05,
+  0x06, 0x04, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x03, 0x04,
+  0x06, 0x03, 0x08, 0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06,
+  0x08, 0x05, 0x06, 0x06, 0x05, 0x03, 0x05, 0x06, 0x05, 0x00, 0x00, 0x00,
+  0x0b, 0x08, 0x06, 0x00, 0x06, 0x06, 0x03, 0x06, 0x08, 0x07, 0x08, 0x08,
+  0x03, 0x04, 0x04, 0x06, 0x06, 0x04, 0x06, 0x03, 0x08, 0x07, 0x04, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x06, 0x06, 0x06,
+  0x07, 0x08, 0x07, 0x07, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07,
+  0x07, 0x06, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07,
+  0x08, 0x07, 0x07, 0x06, 0x04, 0x08, 0x04, 0x06, 0x07, 0x04, 0x07, 0x07,
+  0x06, 0x07, 0x07, 0x06, 0x07, 0x07, 0x03, 0x04, 0x07, 0x03, 0x08, 0x07,
+  0x07, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x07, 0x08, 0x06, 0x07, 0x07,
+  0x06, 0x03, 0x06, 0x07, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x09, 0x06, 0x00,
+  0x06, 0x06, 0x03, 0x06, 0x09, 0x08, 0x09, 0x09, 0x03, 0x05, 0x05, 0x06,
+  0x06, 0x05, 0x06, 0x03, 0x09, 0x08, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x03, 0x03, 0x06, 0x06, 0x06, 0x08, 0x09, 0x08, 0x08,
+  0x06, 0x08, 0x06, 0x06, 0x08, 0x08, 0x06, 0x08, 0x08, 0x06, 0x09, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x08, 0x08, 0x06,
+  0x05, 0x09, 0x05, 0x06, 0x08, 0x05, 0x08, 0x08, 0x06, 0x08, 0x08, 0x06,
+  0x08, 0x08, 0x03, 0x05, 0x08, 0x03, 0x09, 0x08, 0x08, 0x08, 0x08, 0x06,
+  0x08, 0x06, 0x08, 0x08, 0x09, 0x06, 0x08, 0x08, 0x06, 0x03, 0x06, 0x08,
+  0x06, 0x00, 0x00, 0x00, 0x0d, 0x0a, 0x07, 0x00, 0x07, 0x07, 0x03, 0x07,
+  0x0a, 0x08, 0x0a, 0x0a, 0x03, 0x05, 0x05, 0x07, 0x07, 0x05, 0x07, 0x03,
+  0x0a, 0x08, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03,
+  0x03, 0x07, 0x07, 0x07, 0x08, 0x0a, 0x08, 0x08, 0x07, 0x08, 0x07, 0x07,
+  0x08, 0x08, 0x07, 0x08, 0x08, 0x07, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x07, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x07, 0x05, 0x0a, 0x05, 0x07,
+  0x08, 0x05, 0x08, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x08, 0x03, 0x05,
+  0x08, 0x03, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08,
+  0x0a, 0x07, 0x08, 0x08, 0x07, 0x03, 0x07, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x0e, 0x0b, 0x07, 0x00, 0x07, 0x07, 0x04, 0x07, 0x0b, 0x09, 0x0b, 0x0b,
+  0x04, 0x05, 0x05, 0x07, 0x07, 0x05, 0x07, 0x04, 0x0b, 0x09, 0x05, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x04, 0x04, 0x07, 0x07, 0x07,
+  0x09, 0x0b, 0x09, 0x09, 0x07, 0x09, 0x07, 0x07, 0x09, 0x09, 0x07, 0x09,
+  0x09, 0x07, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x09, 0x09,
+  0x0b, 0x09, 0x09, 0x07, 0x05, 0x0b, 0x05, 0x07, 0x09, 0x05, 0x09, 0x09,
+  0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x04, 0x05, 0x09, 0x04, 0x0b, 0x09,
+  0x09, 0x09, 0x09, 0x07, 0x09, 0x07, 0x09, 0x09, 0x0b, 0x07, 0x09, 0x09,
+  0x07, 0x04, 0x07, 0x09, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x08, 0x00,
+  0x08, 0x08, 0x04, 0x08, 0x0b, 0x09, 0x0b, 0x0b, 0x04, 0x06, 0x06, 0x08,
+  0x08, 0x06, 0x08, 0x04, 0x0b, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x04, 0x04, 0x08, 0x08, 0x08, 0x09, 0x0b, 0x09, 0x09,
+  0x08, 0x09, 0x08, 0x08, 0x09, 0x09, 0x08, 0x09, 0x09, 0x08, 0x0b, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x08,
+  0x06, 0x0b, 0x06, 0x08, 0x09, 0x06, 0x09, 0x09, 0x08, 0x09, 0x09, 0x08,
+  0x09, 0x09, 0x04, 0x06, 0x09, 0x04, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x08,
+  0x09, 0x08, 0x09, 0x09, 0x0b, 0x08, 0x09, 0x09, 0x08, 0x04, 0x08, 0x09,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x08, 0x00, 0x08, 0x08, 0x04, 0x08,
+  0x0c, 0x0a, 0x0c, 0x0c, 0x04, 0x06, 0x06, 0x08, 0x08, 0x06, 0x08, 0x04,
+  0x0c, 0x0a, 0x06, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x04,
+  0x04, 0x08, 0x08, 0x08, 0x0a, 0x0c, 0x0a, 0x0a, 0x08, 0x0a, 0x08, 0x08,
+  0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x08, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+  0x0a, 0x08, 0x0a, 0x0a, 0x0c, 0x0a, 0x0a, 0x08, 0x06, 0x0c, 0x06, 0x08,
+  0x0a, 0x06, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x08, 0x0a, 0x0a, 0x04, 0x06,
+  0x0a, 0x04, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x0a, 0x08, 0x0a, 0x0a,
+  0x0c, 0x08, 0x0a, 0x0a, 0x08, 0x04, 0x08, 0x0a, 0x08, 0x00, 0x00, 0x00,
+  0x11, 0x0d, 0x09, 0x00, 0x09, 0x09, 0x04, 0x09, 0x0d, 0x0b, 0x0d, 0x0d,
+  0x04, 0x06, 0x06, 0x09, 0x09, 0x06, 0x09, 0x04, 0x0d, 0x0b, 0x06, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x04, 0x04, 0x09, 0x09, 0x09,
+  0x0b, 0x0d, 0x0b, 0x0b, 0x09, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x09, 0x0b,
+  0x0b, 0x09, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b,
+  0x0d, 0x0b, 0x0b, 0x09, 0x06, 0x0d, 0x06, 0x09, 0x0b, 0x06, 0x0b, 0x0b,
+  0x09, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x04, 0x06, 0x0b, 0x04, 0x0d, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x09, 0x0b, 0x0b, 0x0d, 0x09, 0x0b, 0x0b,
+  0x09, 0x04, 0x09, 0x0b, 0x09, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x09, 0x00,
+  0x09, 0x09, 0x05, 0x09, 0x0e, 0x0b, 0x0e, 0x0e, 0x05, 0x07, 0x07, 0x09,
+  0x09, 0x07, 0x09, 0x05, 0x0e, 0x0b, 0x07, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x05, 0x05, 0x09, 0x09, 0x09, 0x0b, 0x0e, 0x0b, 0x0b,
+  0x09, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x09, 0x0e, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x0e, 0x0b, 0x0b, 0x09,
+  0x07, 0x0e, 0x07, 0x09, 0x0b, 0x07, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x09,
+  0x0b, 0x0b, 0x05, 0x07, 0x0b, 0x05, 0x0e, 0x0b, 0x0b, 0x0b, 0x0b, 0x09,
+  0x0b, 0x09, 0x0b, 0x0b, 0x0e, 0x09, 0x0b, 0x0b, 0x09, 0x05, 0x09, 0x0b,
+  0x09, 0x00, 0x00, 0x00, 0x13, 0x0e, 0x0a, 0x00, 0x0a, 0x0a, 0x05, 0x0a,
+  0x0e, 0x0c, 0x0e, 0x0e, 0x05, 0x07, 0x07, 0x0a, 0x0a, 0x07, 0x0a, 0x05,
+  0x0e, 0x0c, 0x07, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x05,
+  0x05, 0x0a, 0x0a, 0x0a, 0x0c, 0x0e, 0x0c, 0x0c, 0x0a, 0x0c, 0x0a, 0x0a,
+  0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0a, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x0c, 0x0a, 0x0c, 0x0c, 0x0e, 0x0c, 0x0c, 0x0a, 0x07, 0x0e, 0x07, 0x0a,
+  0x0c, 0x07, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x0a, 0x0c, 0x0c, 0x05, 0x07,
+  0x0c, 0x05, 0x0e, 0x0c, 0x0c, 0x0c, 0x0c, 0x0a, 0x0c, 0x0a, 0x0c, 0x0c,
+  0x0e, 0x0a, 0x0c, 0x0c, 0x0a, 0x05, 0x0a, 0x0c, 0x0a, 0x00, 0x00, 0x00,
+  0x14, 0x0f, 0x0a, 0x00, 0x0a, 0x0a, 0x05, 0x0a, 0x0f, 0x0d, 0x0f, 0x0f,
+  0x05, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x0a, 0x05, 0x0f, 0x0d, 0x08, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x05, 0x05, 0x0a, 0x0a, 0x0a,
+  0x0d, 0x0f, 0x0d, 0x0d, 0x0a, 0x0d, 0x0a, 0x0a, 0x0d, 0x0d, 0x0a, 0x0d,
+  0x0d, 0x0a, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x0d, 0x0d,
+  0x0f, 0x0d, 0x0d, 0x0a, 0x08, 0x0f, 0x08, 0x0a, 0x0d, 0x08, 0x0d, 0x0d,
+  0x0a, 0x0d, 0x0d, 0x0a, 0x0d, 0x0d, 0x05, 0x08, 0x0d, 0x05, 0x0f, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0d, 0x0f, 0x0a, 0x0d, 0x0d,
+  0x0a, 0x05, 0x0a, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x10, 0x0b, 0x00,
+  0x0b, 0x0b, 0x05, 0x0b, 0x10, 0x0d, 0x10, 0x10, 0x05, 0x08, 0x08, 0x0b,
+  0x0b, 0x08, 0x0b, 0x05, 0x10, 0x0d, 0x08, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x05, 0x05, 0x0b, 0x0b, 0x0b, 0x0d, 0x10, 0x0d, 0x0d,
+  0x0b, 0x0d, 0x0b, 0x0b, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0b, 0x10, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x10, 0x0d, 0x0d, 0x0b,
+  0x08, 0x10, 0x08, 0x0b, 0x0d, 0x08, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0b,
+  0x0d, 0x0d, 0x05, 0x08, 0x0d, 0x05, 0x10, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b,
+  0x0d, 0x0b, 0x0d, 0x0d, 0x10, 0x0b, 0x0d, 0x0d, 0x0b, 0x05, 0x0b, 0x0d,
+  0x0b, 0x00, 0x00, 0x00, 0x16, 0x11, 0x0b, 0x00, 0x0b, 0x0b, 0x06, 0x0b,
+  0x11, 0x0e, 0x11, 0x11, 0x06, 0x08, 0x08, 0x0b, 0x0b, 0x08, 0x0b, 0x06,
+  0x11, 0x0e, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x06,
+  0x06, 0x0b, 0x0b, 0x0b, 0x0e, 0x11, 0x0e, 0x0e, 0x0b, 0x0e, 0x0b, 0x0b,
+  0x0e, 0x0e, 0x0b, 0x0e, 0x0e, 0x0b, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+  0x0e, 0x0b, 0x0e, 0x0e, 0x11, 0x0e, 0x0e, 0x0b, 0x08, 0x11, 0x08, 0x0b,
+  0x0e, 0x08, 0x0e, 0x0e, 0x0b, 0x0e, 0x0e, 0x0b, 0x0e, 0x0e, 0x06, 0x08,
+  0x0e, 0x06, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0b, 0x0e, 0x0b, 0x0e, 0x0e,
+  0x11, 0x0b, 0x0e, 0x0e, 0x0b, 0x06, 0x0b, 0x0e, 0x0b, 0x00, 0x00, 0x00,
+  0x17, 0x11, 0x0c, 0x00, 0x0c, 0x0c, 0x06, 0x0c, 0x11, 0x0e, 0x11, 0x11,
+  0x06, 0x09, 0x09, 0x0c, 0x0c, 0x09, 0x0c, 0x06, 0x11, 0x0e, 0x09, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x06, 0x0c, 0x0c, 0x0c,
+  0x0e, 0x11, 0x0e, 0x0e, 0x0c, 0x0e, 0x0c, 0x0c, 0x0e, 0x0e, 0x0c, 0x0e,
+  0x0e, 0x0c, 0x11, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x0e, 0x0e,
+  0x11, 0x0e, 0x0e, 0x0c, 0x09, 0x11, 0x09, 0x0c, 0x0e, 0x09, 0x0e, 0x0e,
+  0x0c, 0x0e, 0x0e, 0x0c, 0x0e, 0x0e, 0x06, 0x09, 0x0e, 0x06, 0x11, 0x0e,
+  0x0e, 0x0e, 0x0e, 0x0c, 0x0e, 0x0c, 0x0e, 0x0e, 0x11, 0x0c, 0x0e, 0x0e,
+  0x0c, 0x06, 0x0c, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x12, 0x0c, 0x00,
+  0x0c, 0x0c, 0x06, 0x0c, 0x12, 0x0f, 0x12, 0x12, 0x06, 0x09, 0x09, 0x0c,
+  0x0c, 0x09, 0x0c, 0x06, 0x12, 0x0f, 0x09, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x06, 0x06, 0x0c, 0x0c, 0x0c, 0x0f, 0x12, 0x0f, 0x0f,
+  0x0c, 0x0f, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c, 0x12, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x12, 0x0f, 0x0f, 0x0c,
+  0x09, 0x12, 0x09, 0x0c, 0x0f, 0x09, 0x0f, 0x0f, 0x0c, 0x0f, 0x0f, 0x0c,
+  0x0f, 0x0f, 0x06, 0x09, 0x0f, 0x06, 0x12, 0x0f, 0x0f, 0x0f, 0x0f, 0x0c,
+  0x0f, 0x0c, 0x0f, 0x0f, 0x12, 0x0c, 0x0f, 0x0f, 0x0c, 0x06, 0x0c, 0x0f,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x01, 0x90, 0x00, 0x05,
+  0x00, 0x01, 0x02, 0xbc, 0x02, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0x02, 0xbc,
+  0x02, 0x8a, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x32, 0x01, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x6c, 0x74, 0x73, 0x00, 0x40, 0x00, 0x20, 0x20, 0x10,
+  0x02, 0xee, 0xff, 0x06, 0x00, 0x00, 0x02, 0xee, 0x00, 0xfa, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x52, 0xfa, 0xb7, 0x1f,
+  0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00,
+  0xba, 0xa6, 0x78, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xba, 0xa6, 0x78, 0xfd,
+  0x00, 0x00, 0xff, 0x06, 0x02, 0x71, 0x02, 0xee, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0xee, 0xff, 0x06, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x00, 0x3e,
+  0x02, 0x71, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x63, 0x00, 0x20, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x08, 0x00, 0x40, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x60, 0x00, 0xa7,
+  0x00, 0x01, 0x00, 0x01
+};
+static const unsigned int tiny_ttf_len = 19492;
+
+#endif // PICO_TINY_H
@@ -0,0 +1,207 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "world.h"
+
+typedef struct pico_world_bucket {
+    int n, cap;
+    int* ids;
+} pico_world_bucket;
+
+typedef struct pico_world_obj {
+    SDL_Rect r;                 // resolved to the top-left corner
+    int x0, y0, x1, y1;         // range of cells covered, inclusive
+    int next;                   // next free id, when removed (-2 if alive)
+    unsigned mark;              // last query that reported it
+} pico_world_obj;
+
+struct pico_world {
+    int cell;
+    int n, cap;
+    int free;                   // first free id, or -1
+    unsigned mark;
+    pico_world_obj* objs;
+    pico_world_bucket buckets[PICO_WORLD_BUCKETS];
+};
+
+#define ALIVE (-2)
+
+static int _pico_world_cell (pico_world* w, int v) {
+    return (v >= 0) ? v/w->cell : -((-v-1)/w->cell) - 1;
+}
+
+static pico_world_bucket* _pico_world_bucket (pico_world* w, int cx, int cy) {
+    unsigned h = ((unsigned)cx * 73856093u) ^ ((unsigned)cy * 19349663u);
+    return &w->buckets[h & (PICO_WORLD_BUCKETS-1)];
+}
+
+static SDL_Rect _pico_world_anchor (SDL_Rect r, SDL_Point a) {
+    r.x -= (a.x*r.w)/100;
+    r.y -= (a.y*r.h)/100;
+    return r;
+}
+
+// Cells hashing to the same bucket share it, so an id is only kept once.
+static void _pico_world_link (pico_world* w, int id) {
+    pico_world_obj* o = &w->objs[id];
+    for (int cy=o->y0; cy<=o->y1; cy++) {
+        for (int cx=o->x0; cx<=o->x1; cx++) {
+            pico_world_bucket* b = _pico_world_bucket(w, cx, cy);
+            int has = 0;
+            for (int i=0; i<b->n && !has; i++) {
+                has = (b->ids[i] == id);
+            }
+            if (has) {
+                continue;
+            }
+            if (b->n == b->cap) {
+                b->cap = (b->cap == 0) ? 8 : b->cap*2;
+                b->ids = realloc(b->ids, b->cap*sizeof(int));
+                assert(b->ids != NULL && "cannot grow world");
+            }
+            b->ids[b->n++] = id;
+        }
+    }
+}
+
+static void _pico_world_unlink (pico_world* w, int id, const pico_world_obj* o) {
+    for (int cy=o->y0; cy<=o->y1; cy++) {
+        for (int cx=o->x0; cx<=o->x1; cx++) {
+            pico_world_bucket* b = _pico_world_bucket(w, cx, cy);
+            for (int i=0; i<b->n; i++) {
+                if (b->ids[i] == id) {
+                    b->ids[i] = b->ids[--b->n];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void _pico_world_place (pico_world* w, int id, SDL_Rect r, SDL_Point a) {
+    pico_world_obj* o = &w->objs[id];
+    o->r  = _pico_world_anchor(r, a);
+    o->x0 = _pico_world_cell(w, o->r.x);
+    o->y0 = _pico_world_cell(w, o->r.y);
+    o->x1 = _pico_world_cell(w, o->r.x + (o->r.w>0 ? o->r.w-1 : 0));
+    o->y1 = _pico_world_cell(w, o->r.y + (o->r.h>0 ? o->r.h-1 : 0));
+}
+
+pico_world* pico_world_create (int cell) {
+    assert(cell > 0 && "invalid cell size");
+    pico_world* w = calloc(1, sizeof(pico_world));
+    if (w == NULL) {
+        return NULL;
+    }
+    w->cell = cell;
+    w->free = -1;
+    return w;
+}
+
+void pico_world_destroy (pico_world* w) {
+    for (int i=0; i<PICO_WORLD_BUCKETS; i++) {
+        free(w->buckets[i].ids);
+    }
+    free(w->objs);
+    free(w);
+}
+
+int pico_world_add (pico_world* w, SDL_Rect r, SDL_Point anchor) {
+    int id;
+    if (w->free != -1) {
+        id = w->free;
+        w->free = w->objs[id].next;
+    } else {
+        if (w->n == w->cap) {
+            w->cap = (w->cap == 0) ? 64 : w->cap*2;
+            w->objs = realloc(w->objs, w->cap*sizeof(pico_world_obj));
+            assert(w->objs != NULL && "cannot grow world");
+        }
+        id = w->n++;
+    }
+    w->objs[id].next = ALIVE;
+    w->objs[id].mark = 0;
+    _pico_world_place(w, id, r, anchor);
+    _pico_world_link(w, id);
+    return id;
+}
+
+// Moving within the same cells does not touch the buckets.
+void pico_world_set (pico_world* w, int id, SDL_Rect r, SDL_Point anchor) {
+    assert(0<=id && id<w->n && w->objs[id].next==ALIVE && "invalid world id");
+    pico_world_obj old = w->objs[id];
+    _pico_world_place(w, id, r, anchor);
+    pico_world_obj* o = &w->objs[id];
+    if (o->x0!=old.x0 || o->y0!=old.y0 || o->x1!=old.x1 || o->y1!=old.y1) {
+        _pico_world_unlink(w, id, &old);
+        _pico_world_link(w, id);
+    }
+}
+
+void pico_world_rem (pico_world* w, int id) {
+    assert(0<=id && id<w->n && w->objs[id].next==ALIVE && "invalid world id");
+    _pico_world_unlink(w, id, &w->objs[id]);
+    w->objs[id].next = w->free;
+    w->free = id;
+}
+
+// Each pair is reported only from the first cell both cover.
+int pico_world_pairs (pico_world* w, int pairs[][2], int max) {
+    int n = 0;
+    for (int a=0; a<w->n; a++) {
+        const pico_world_obj* oa = &w->objs[a];
+        if (oa->next != ALIVE) {
+            continue;
+        }
+        for (int cy=oa->y0; cy<=oa->y1; cy++) {
+            for (int cx=oa->x0; cx<=oa->x1; cx++) {
+                const pico_world_bucket* bk = _pico_world_bucket(w, cx, cy);
+                for (int i=0; i<bk->n; i++) {
+                    int b = bk->ids[i];
+                    const pico_world_obj* ob = &w->objs[b];
+                    if (b<=a || cx<ob->x0 || cx>ob->x1 || cy<ob->y0 || cy>ob->y1) {
+                        continue;
+                    }
+                    int fx = (oa->x0 > ob->x0) ? oa->x0 : ob->x0;
+                    int fy = (oa->y0 > ob->y0) ? oa->y0 : ob->y0;
+                    if (cx!=fx || cy!=fy || !SDL_HasIntersection(&oa->r, &ob->r)) {
+                        continue;
+                    }
+                    if (n < max) {
+                        pairs[n][0] = a;
+                        pairs[n][1] = b;
+                    }
+                    n++;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+int pico_world_query (pico_world* w, SDL_Rect r, SDL_Point anchor, int ids[], int max) {
+    r = _pico_world_anchor(r, anchor);
+    int x0 = _pico_world_cell(w, r.x);
+    int y0 = _pico_world_cell(w, r.y);
+    int x1 = _pico_world_cell(w, r.x + (r.w>0 ? r.w-1 : 0));
+    int y1 = _pico_world_cell(w, r.y + (r.h>0 ? r.h-1 : 0));
+    unsigned mark = ++w->mark;
+    int n = 0;
+    for (int cy=y0; cy<=y1; cy++) {
+        for (int cx=x0; cx<=x1; cx++) {
+            const pico_world_bucket* bk = _pico_world_bucket(w, cx, cy);
+            for (int i=0; i<bk->n; i++) {
+                pico_world_obj* o = &w->objs[bk->ids[i]];
+                if (o->mark==mark || !SDL_HasIntersection(&o->r, &r)) {
+                    continue;
+                }
+                o->mark = mark;
+                if (n < max) {
+                    ids[n] = bk->ids[i];
+                }
+                n++;
+            }
+        }
+    }
+    return n;
+}
@@ -0,0 +1,35 @@
+#ifndef PICO_WORLD_H
+#define PICO_WORLD_H
+
+#include <SDL2/SDL_rect.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Broadphase for many rectangles: a uniform grid whose cells are hashed
+// into a fixed number of buckets, so that queries only test rectangles
+// sharing a cell.
+// Rectangles are anchored as in pico_rect_vs_rect_ext: the anchor is in
+// percent of the size, e.g. {50,50} for the center.
+
+#define PICO_WORLD_BUCKETS 4096     // power of 2
+
+typedef struct pico_world pico_world;
+
+// Queries return the number of results found, of which at most max are
+// written. Ids of removed rectangles are reused.
+
+pico_world* pico_world_create (int cell);
+void pico_world_destroy (pico_world* w);
+int  pico_world_add (pico_world* w, SDL_Rect r, SDL_Point anchor);
+void pico_world_set (pico_world* w, int id, SDL_Rect r, SDL_Point anchor);
+void pico_world_rem (pico_world* w, int id);
+int  pico_world_pairs (pico_world* w, int pairs[][2], int max);
+int  pico_world_query (pico_world* w, SDL_Rect r, SDL_Point anchor, int ids[], int max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PICO_WORLD_H
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL2/SDL_image.h>
+
+#include "pak.h"
+
+// Packs files into an archive for pico_set_archive.
+// Usage: pak [-d] <out.pak> <file>...
+//  -d: stores images decoded to RGBA8888, so that loading skips decoding
+// Entries are named by the paths as given, which is how they are looked up.
+
+static void* read_file (const char* path, uint32_t* size) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    void* buf = malloc(*size + 1);
+    if (buf!=NULL && fread(buf,1,*size,f)!=*size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+static void* decode_image (const char* path, pico_pak_ent* ent) {
+    SDL_Surface* img = IMG_Load(path);
+    if (img == NULL) {
+        return NULL;
+    }
+    SDL_Surface* sfc = SDL_ConvertSurfaceFormat(img, SDL_PIXELFORMAT_RGBA8888, 0);
+    SDL_FreeSurface(img);
+    if (sfc == NULL) {
+        return NULL;
+    }
+    ent->type = PICO_PAK_RGBA;
+    ent->w = sfc->w;
+    ent->h = sfc->h;
+    ent->size = 4 * sfc->w * sfc->h;
+    char* buf = malloc(ent->size + 1);
+    if (buf != NULL) {
+        for (int y=0; y<sfc->h; y++) {
+            memcpy(buf + 4*sfc->w*y, (char*)sfc->pixels + sfc->pitch*y, 4*sfc->w);
+        }
+    }
+    SDL_FreeSurface(sfc);
+    return buf;
+}
+
+int main (int argc, char* argv[]) {
+    int decode = (argc > 1 && strcmp(argv[1], "-d") == 0);
+    int i0 = 1 + decode;
+    if (argc < i0+2) {
+        fprintf(stderr, "usage: %s [-d] <out.pak> <file>...\n", argv[0]);
+        return 1;
+    }
+    const char* out = argv[i0];
+    int n = argc - i0 - 1;
+    const char** names = (const char**) &argv[i0+1];
+    pico_pak_ent* ents = calloc(n, sizeof(pico_pak_ent));
+    const void** datas = calloc(n, sizeof(void*));
+    if (ents==NULL || datas==NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (int i=0; i<n; i++) {
+        void* data = decode ? decode_image(names[i], &ents[i]) : NULL;
+        if (data == NULL) {
+            ents[i] = (pico_pak_ent) { 0, PICO_PAK_RAW, 0, 0, 0, 0 };
+            data = read_file(names[i], &ents[i].size);
+        }
+        if (data == NULL) {
+            fprintf(stderr, "cannot read %s\n", names[i]);
+            return 1;
+        }
+        datas[i] = data;
+        printf("%s %s (%u bytes)\n", names[i],
+            (ents[i].type == PICO_PAK_RGBA) ? "decoded" : "raw", ents[i].size);
+    }
+
+    if (!pico_pak_write(out, n, names, ents, datas)) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 1;
+    }
+    return 0;
+}
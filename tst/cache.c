@@ -0,0 +1,26 @@
+#include "pico.h"
+
+// run twice: the first run decodes and stores, the second reads back
+//  PICO_IMAGE_CACHE=cache ./cache
+
+int main (void) {
+    if (SDL_getenv("PICO_IMAGE_CACHE") == NULL) {
+        SDL_setenv("PICO_IMAGE_CACHE", "cache", 0);
+    }
+    pico_init(1);
+    pico_set_title("Cache");
+
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    pico_output_draw_image(pico_pos(50, 50), "open.png");
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    pico_output_present();
+
+    Pico_Stats s = pico_get_stats();
+    printf("hits=%u misses=%u load=%lluus\n", s.cache.hits, s.cache.misses,
+           (unsigned long long)((t1-t0) * 1000000 / SDL_GetPerformanceFrequency()));
+    assert(s.cache.hits + s.cache.misses == 1);
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "pico.h"
+
+// a tiled world under a camera that pans at sub-pixel speed, zooms and
+// turns, with the time spent per frame; clicks mark the world position
+
+#define W 40
+#define H 40
+
+static Uint64 usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+static void world (void) {
+    for (int j=0; j<H; j++) {
+        for (int i=0; i<W; i++) {
+            pico_set_color_draw((Pico_Color){0x20+4*i, 0x20+4*j, 0x80, 0xFF});
+            pico_set_style((i+j)%2 ? PICO_FILL : PICO_STROKE);
+            pico_output_draw_rect((Pico_Rect){10*i, 10*j, 9, 9});
+        }
+    }
+    pico_set_color_draw((Pico_Color){0xFF,0xFF,0xFF,0xFF});
+    pico_set_style(PICO_FILL);
+    pico_output_draw_oval((Pico_Rect){200, 200, 30, 20});
+    pico_output_draw_line((Pico_Pos){0,0}, (Pico_Pos){10*W,10*H});
+    pico_output_draw_image((Pico_Pos){100,100}, "open.png");
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Camera");
+    pico_set_size((Pico_Dim){640,360}, (Pico_Dim){320,180});
+    pico_set_expert(1);
+    pico_set_anchor((Pico_Anchor){PICO_LEFT,PICO_TOP});
+
+    // without a camera, positions map to themselves
+    {
+        Pico_Camera cam = pico_get_camera();
+        assert(cam.x==0 && cam.y==0 && cam.zoom==1 && cam.angle==0);
+    }
+
+    // the world is recorded once and drawn under each camera
+    pico_set_record("world");
+    world();
+    pico_set_record(NULL);
+
+    Uint64 drw = 0;
+    int frames = 0;
+    float t = 0;
+    Pico_Pos marks[64];
+    int n = 0;
+    while (1) {
+        pico_input_poll();
+        if (pico_get_key_pressed(PICOK_ESCAPE)) {
+            break;
+        }
+        if (pico_get_mouse_pressed(SDL_BUTTON_LEFT) && n<64) {
+            marks[n++] = pico_get_mouse();
+        }
+
+        Pico_Camera cam = {
+            t*15, t*10, 1.5 + SDL_sinf(t), 10*t
+        };
+        pico_set_camera(cam);
+        assert(pico_get_camera().zoom == cam.zoom);
+
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        pico_set_color_clear((Pico_Color){0x00,0x00,0x00,0xFF});
+        pico_output_clear();
+        pico_output_draw_list((Pico_Pos){0,0}, "world");
+        pico_set_color_draw((Pico_Color){0xFF,0x00,0x00,0xFF});
+        for (int i=0; i<n; i++) {
+            pico_output_draw_pixel(marks[i]);
+        }
+        pico_output_present();
+        drw += usecs(t0);
+
+        if (++frames == 60) {
+            printf("camera (%.2f,%.2f) zoom=%.2f angle=%.0f: draw=%lluus per frame\n",
+                   cam.x, cam.y, cam.zoom, cam.angle, (unsigned long long)(drw/60));
+            drw = frames = 0;
+        }
+        t += 1.0/60;
+        pico_input_delay(16);
+    }
+
+    pico_set_camera(PICO_CAMERA_NONE);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "pico.h"
+
+// run with SDL_RENDER_DRIVER=software to only copy dirty regions
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Dirty");
+    pico_output_clear();
+
+    Pico_Stats s1 = pico_get_stats();
+    printf("clear: %d pixels copied\n", s1.copy.pixels);
+
+    pico_output_draw_pixel(pico_pos(50, 50));
+    Pico_Stats s2 = pico_get_stats();
+    printf("pixel: %d pixels copied\n", s2.copy.pixels);
+
+    pico_set_expert(1);
+    pico_output_draw_rect((Pico_Rect){10, 10, 4, 4});
+    pico_output_draw_rect((Pico_Rect){20, 20, 4, 4});
+    pico_output_present();
+    Pico_Stats s3 = pico_get_stats();
+    printf("rects: %d pixels copied\n", s3.copy.pixels);
+    assert(s3.frames == s2.frames+1);
+    pico_set_expert(0);
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
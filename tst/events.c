@@ -0,0 +1,28 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Events");
+    pico_set_expert(1);
+
+    puts("prints keys and clicks of each frame, escape quits");
+    int types[] = { PICO_KEYDOWN, PICO_MOUSEBUTTONDOWN };
+    while (1) {
+        Pico_Event buf[16];
+        int n = pico_input_events(buf, 16, types, 2);
+        assert(0<=n && n<=16);
+        for (int i=0; i<n; i++) {
+            if (buf[i].type == PICO_KEYDOWN) {
+                if (buf[i].key.keysym.sym == PICOK_ESCAPE) {
+                    pico_init(0);
+                    return 0;
+                }
+                printf("key %d\n", buf[i].key.keysym.sym);
+            } else {
+                printf("click (%d,%d)\n", buf[i].button.x, buf[i].button.y);
+            }
+        }
+        pico_output_present();
+        SDL_Delay(100);     // lets events pile up
+    }
+}
@@ -0,0 +1,22 @@
+#include "pico.h"
+
+// toggles between two sizes of the embedded default font, whose handles
+// are opened once and then reused
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Fonts");
+    pico_set_anchor((Pico_Anchor){PICO_LEFT, PICO_TOP});
+
+    for (int i=0; i<20; i++) {
+        pico_set_font(NULL, 10);
+        pico_output_draw_text((Pico_Pos){2, 2}, "Title");
+        pico_set_font(NULL, 6);
+        pico_output_draw_text((Pico_Pos){2, 20}, "body text");
+    }
+    assert(pico_get_font() != NULL);
+
+    pico_input_delay(1000);
+    pico_init(0);
+    return 0;
+}
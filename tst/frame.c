@@ -0,0 +1,30 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Frame");
+    pico_set_expert(1);
+
+    for (int i=0; i<50; i++) {
+        // scratch points only live until the present
+        int n = 64;
+        Pico_Pos* pts = pico_frame_alloc(n * sizeof(Pico_Pos));
+        for (int j=0; j<n; j++) {
+            pts[j] = (Pico_Pos) { (i+j) % 64, j };
+        }
+        pico_output_clear();
+        pico_output_draw_pixels(pts, n);
+        pico_output_present();
+        pico_input_delay(20);
+    }
+
+    Pico_Stats s = pico_get_stats();
+    printf("arena: %d bytes, peak %d\n", s.frame.size, s.frame.peak);
+    assert(s.frame.peak >= 2*64*sizeof(Pico_Pos));
+    assert(s.frame.peak <= s.frame.size);
+
+    pico_set_expert(0);
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
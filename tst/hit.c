@@ -0,0 +1,60 @@
+#include "pico.h"
+
+// one point and one rectangle against 100k rectangles, one by one and in
+// batch, in both layouts
+
+#define N 100000
+
+static Pico_Rect rs[N];
+static int xs[N], ys[N], ws[N], hs[N];
+static int ids[N];
+
+static Uint64 usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Hit");
+    pico_set_anchor((Pico_Anchor){PICO_CENTER, PICO_MIDDLE});
+
+    for (int i=0; i<N; i++) {
+        rs[i] = (Pico_Rect) { rand()%64, rand()%36, 1+rand()%8, 1+rand()%8 };
+        xs[i]=rs[i].x; ys[i]=rs[i].y; ws[i]=rs[i].w; hs[i]=rs[i].h;
+    }
+    Pico_Rects soa = { xs, ys, ws, hs };
+    Pico_Pos pt = { 32, 18 };
+    Pico_Rect r = { 32, 18, 4, 4 };
+
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    int n1 = 0;
+    for (int i=0; i<N; i++) {
+        n1 += pico_pos_vs_rect(pt, rs[i]);
+    }
+    printf("pos loop:  %d hits %lluus\n", n1, (unsigned long long)usecs(t0));
+
+    t0 = SDL_GetPerformanceCounter();
+    int n2 = pico_pos_vs_rects(pt, rs, N, ids);
+    printf("pos batch: %d hits %lluus\n", n2, (unsigned long long)usecs(t0));
+    assert(n1 == n2);
+    assert(pico_pos_vs_rects_soa(pt, soa, N, ids) == n1);
+
+    t0 = SDL_GetPerformanceCounter();
+    int n3 = 0;
+    for (int i=0; i<N; i++) {
+        n3 += pico_rect_vs_rect_ext(r, pico_get_anchor(), rs[i], pico_get_anchor());
+    }
+    printf("rect loop:  %d hits %lluus\n", n3, (unsigned long long)usecs(t0));
+
+    t0 = SDL_GetPerformanceCounter();
+    int n4 = pico_rect_vs_rects(r, rs, N, ids);
+    printf("rect batch: %d hits %lluus\n", n4, (unsigned long long)usecs(t0));
+    assert(n3 == n4);
+    assert(pico_rect_vs_rects_soa(r, soa, N, ids) == n3);
+    for (int i=1; i<n4; i++) {
+        assert(ids[i-1] < ids[i]);
+    }
+
+    pico_init(0);
+    return 0;
+}
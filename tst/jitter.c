@@ -0,0 +1,57 @@
+#include "pico.h"
+
+// compares the requested delay with the measured one
+
+#define N 100
+
+static Uint64 usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+static void report (const char* name, Uint64 want, Uint64 got[]) {
+    Uint64 sum=0, max=0;
+    for (int i=0; i<N; i++) {
+        Uint64 err = (got[i] > want) ? got[i]-want : want-got[i];
+        sum += err;
+        max = (err > max) ? err : max;
+    }
+    printf("%-12s want=%5lluus  mean err=%4lluus  max err=%4lluus\n", name,
+           (unsigned long long)want, (unsigned long long)(sum/N), (unsigned long long)max);
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Jitter");
+    Uint64 got[N];
+
+    // previous implementation: millisecond ticks around the wait
+    for (int i=0; i<N; i++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        int ms = 5;
+        while (ms > 0) {
+            int old = SDL_GetTicks();
+            Pico_Event e;
+            SDL_WaitEventTimeout(&e, ms);
+            ms -= SDL_GetTicks() - old;
+        }
+        got[i] = usecs(t0);
+    }
+    report("ticks", 5000, got);
+
+    for (int i=0; i<N; i++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        pico_input_delay(5);
+        got[i] = usecs(t0);
+    }
+    report("delay", 5000, got);
+
+    for (int i=0; i<N; i++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        pico_input_delay_us(500);
+        got[i] = usecs(t0);
+    }
+    report("delay_us", 500, got);
+
+    pico_init(0);
+    return 0;
+}
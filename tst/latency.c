@@ -0,0 +1,19 @@
+#include "pico.h"
+
+// run with PICO_AUDIO_BUFFER=256 for lower latency
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Latency");
+    printf("audio latency: %d ms\n", pico_get_latency());
+
+    puts("plays more sounds than channels");
+    for (int i=0; i<2*PICO_CHANNELS; i++) {
+        pico_output_sound("start.wav");
+        pico_input_delay(20);
+    }
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Layers");
+
+    puts("background layer below the main screen");
+    pico_set_layer("bg");
+    pico_set_layer_z("bg", -1);
+    pico_set_color_draw((Pico_Color){0x00,0x00,0xFF,0xFF});
+    pico_output_draw_rect((Pico_Rect){32, 18, 40, 20});
+
+    pico_set_layer(NULL);
+    pico_set_color_clear((Pico_Color){0x00,0x00,0x00,0x00});
+    pico_output_clear();
+    pico_set_color_draw((Pico_Color){0xFF,0xFF,0xFF,0xFF});
+    pico_output_draw_rect((Pico_Rect){32, 18, 10, 10});
+    assert(pico_get_layer() == NULL);
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    puts("scrolls the background, the main screen is kept");
+    for (int i=0; i<10; i++) {
+        pico_set_layer_scroll("bg", (Pico_Pos){i, 0});
+        pico_input_delay(100);
+    }
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    puts("half transparent background");
+    pico_set_layer_alpha("bg", 0x80);
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    puts("hides the background");
+    pico_set_layer_show("bg", 0);
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("List");
+    pico_set_anchor((Pico_Anchor){PICO_LEFT, PICO_TOP});
+
+    puts("records a small scene");
+    pico_set_record("scene");
+    assert(!strcmp(pico_get_record(), "scene"));
+    pico_set_color_draw((Pico_Color){0xFF,0x00,0x00,0xFF});
+    pico_output_draw_rect((Pico_Rect){2, 2, 8, 8});
+    pico_set_color_draw((Pico_Color){0x00,0xFF,0x00,0xFF});
+    pico_output_draw_line((Pico_Pos){2, 12}, (Pico_Pos){10, 12});
+    pico_set_color_draw((Pico_Color){0xFF,0xFF,0xFF,0xFF});
+    pico_output_draw_text((Pico_Pos){2, 14}, "hi");
+    pico_set_record(NULL);
+    assert(pico_get_record() == NULL);
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    puts("replays it moving right");
+    for (int i=0; i<40; i++) {
+        pico_output_clear();
+        pico_output_draw_list((Pico_Pos){i, 10}, "scene");
+        pico_input_delay(50);
+    }
+    pico_input_event(NULL, PICO_KEYDOWN);
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Mask");
+
+    puts("ignores the mouse while waiting for a key");
+    pico_set_event(PICO_MOUSEMOTION, 0);
+    assert(!pico_get_event(PICO_MOUSEMOTION));
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_set_event(PICO_MOUSEMOTION, 1);
+    assert(pico_get_event(PICO_MOUSEMOTION));
+
+    puts("waits for a click or a key, up to 5s");
+    int types[] = { PICO_MOUSEBUTTONDOWN, PICO_KEYDOWN };
+    Pico_Event e;
+    if (pico_input_event_any(&e, types, 2, 5000)) {
+        printf("got %s\n", (e.type == PICO_KEYDOWN) ? "key" : "click");
+    } else {
+        puts("timeout");
+    }
+
+    puts("prints merged mouse motions for 3s");
+    Uint32 t0 = pico_get_ticks();
+    int motion[] = { PICO_MOUSEMOTION };
+    while (pico_get_ticks() - t0 < 3000) {
+        if (pico_input_event_any(&e, motion, 1, 100)) {
+            printf("at (%d,%d) moved (%d,%d)\n", e.motion.x, e.motion.y,
+                   e.motion.xrel, e.motion.yrel);
+            SDL_Delay(50);          // lets motions pile up
+        }
+    }
+
+    pico_init(0);
+    return 0;
+}
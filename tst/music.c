@@ -0,0 +1,34 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Music");
+
+    puts("loops the music");
+    pico_output_music("start.wav");
+    pico_input_delay(2000);
+
+    puts("pauses and resumes it");
+    pico_set_music_pause(1);
+    assert(pico_get_music_pause());
+    pico_input_delay(1000);
+    pico_set_music_pause(0);
+    assert(!pico_get_music_pause());
+
+    puts("lowers the volume");
+    pico_set_music_volume(30);
+    assert(pico_get_music_volume() == 30);
+    pico_input_delay(2000);
+    pico_set_music_volume(100);
+
+    puts("fades to the same music played twice");
+    pico_output_music_ext("start.wav", 2, 500);
+    pico_input_delay(3000);
+
+    puts("fades out");
+    pico_output_music_ext(NULL, 0, 500);
+    pico_input_delay(1000);
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "pico.h"
+#include "pak.h"
+
+// assets can also be packed from the shell:
+//  ../pico-pak -d assets.pak open.png start.wav
+
+static void* load (const char* path, uint32_t* size) {
+    FILE* f = fopen(path, "rb");
+    assert(f != NULL);
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    void* buf = malloc(*size);
+    assert(fread(buf, 1, *size, f) == *size);
+    fclose(f);
+    return buf;
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Pak");
+
+    puts("packs an image and a sound");
+    const char* names[] = { "open.png", "start.wav" };
+    pico_pak_ent ents[2] = { {0,PICO_PAK_RAW,0,0,0,0}, {0,PICO_PAK_RAW,0,0,0,0} };
+    const void* datas[] = { load(names[0],&ents[0].size), load(names[1],&ents[1].size) };
+    assert(pico_pak_write("assets.pak", 2, names, ents, datas));
+
+    puts("rejects an image entry shorter than its pixels");
+    {
+        const char* bad[] = { "short" };
+        Uint32 px[4] = { 0 };
+        pico_pak_ent ent = { 0, PICO_PAK_RGBA, 0, sizeof(px), 4, 4 };
+        const void* data[] = { px };
+        assert(pico_pak_write("short.pak", 1, bad, &ent, data));
+        assert(pico_pak_open("short.pak") == NULL);
+        remove("short.pak");
+    }
+
+    puts("loads them from the archive");
+    pico_set_archive("assets.pak");
+    remove("assets.pak");   // stays mapped
+    Pico_Dim dim = pico_get_image_size("open.png");
+    printf("open.png: %dx%d\n", dim.x, dim.y);
+    pico_output_draw_image(pico_pos(50, 50), "open.png");
+    pico_output_sound("start.wav");
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "pico.h"
+
+// a fountain of up to 200k particles, with the time spent per frame
+
+#define N 200000
+
+static Uint64 usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Particles");
+    pico_set_size((Pico_Dim){640,360}, (Pico_Dim){320,180});
+    pico_set_expert(1);
+
+    Pico_Particles* ps = pico_particles_create(N);
+    Uint64 upd=0, drw=0;
+    int frames = 0;
+    Pico_Event e;
+    while (!pico_input_event_ask(&e, PICO_KEYDOWN)) {
+        pico_set_color_draw((Pico_Color){0xFF, 0x80+rand()%0x80, 0x20, 0xFF});
+        pico_particles_emit(ps, N/120, pico_pos(50,80), 120, 2);
+
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        pico_particles_update(ps, 1.0/60, 0, 60);
+        upd += usecs(t0);
+
+        t0 = SDL_GetPerformanceCounter();
+        pico_output_clear();
+        pico_output_draw_particles(ps);
+        pico_output_present();
+        drw += usecs(t0);
+
+        if (++frames == 60) {
+            printf("%d particles: update=%lluus draw=%lluus per frame\n",
+                   pico_particles_count(ps),
+                   (unsigned long long)(upd/60), (unsigned long long)(drw/60));
+            upd = drw = frames = 0;
+        }
+        pico_input_delay(16);
+    }
+    assert(pico_particles_count(ps) <= N);
+
+    pico_particles_destroy(ps);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Poll");
+    pico_set_expert(1);
+
+    puts("arrows move, click jumps, space prints, escape quits");
+    Pico_Pos pos = { 32, 18 };
+    while (1) {
+        pico_input_poll();
+        if (pico_get_key_pressed(PICOK_ESCAPE)) {
+            break;
+        }
+        if (pico_get_key_pressed(PICOK_SPACE)) {
+            puts("space pressed");
+        }
+        if (pico_get_key_released(PICOK_SPACE)) {
+            puts("space released");
+        }
+        pos.x += pico_get_key(PICOK_RIGHT) - pico_get_key(PICOK_LEFT);
+        pos.y += pico_get_key(PICOK_DOWN)  - pico_get_key(PICOK_UP);
+        if (pico_get_mouse_pressed(SDL_BUTTON_LEFT)) {
+            pos = pico_get_mouse();
+            printf("click at (%d,%d)\n", pos.x, pos.y);
+        }
+        assert(!(pico_get_key_pressed(PICOK_SPACE) && pico_get_key_released(PICOK_SPACE)));
+
+        pico_output_clear();
+        pico_output_draw_pixel(pos);
+        pico_output_present();
+        pico_input_delay(16);
+    }
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Push");
+
+    Pico_Color white = {0xFF,0xFF,0xFF,0xFF};
+    Pico_Color red   = {0xFF,0x00,0x00,0xFF};
+
+    puts("draws with a pushed state");
+    pico_push();
+    pico_set_color_draw(red);
+    pico_set_anchor((Pico_Anchor){PICO_LEFT, PICO_TOP});
+    pico_output_draw_rect((Pico_Rect){4, 4, 10, 10});
+    pico_pop();
+    Pico_Color c = pico_get_color_draw();
+    assert(!memcmp(&c, &white, sizeof(Pico_Color)));
+    assert(pico_get_anchor().x == PICO_CENTER);
+    pico_output_draw_rect((Pico_Rect){32, 32, 10, 10});
+
+    puts("repeated colors are not set again");
+    pico_set_expert(1);
+    Pico_Stats s1 = pico_get_stats();
+    for (int i=0; i<10; i++) {
+        pico_output_draw_pixel((Pico_Pos){10+i, 50});
+    }
+    pico_output_present();
+    pico_set_expert(0);
+    Pico_Stats s2 = pico_get_stats();
+    printf("state: %d calls, %d avoided\n", s2.state.calls, s2.state.avoided);
+    assert(s2.state.avoided > s1.state.avoided);
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
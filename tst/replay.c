@@ -0,0 +1,54 @@
+#include "pico.h"
+
+// the first run records 3s of input, later runs replay it:
+//  PICO_INPUT_FAST=1 ./replay
+
+int main (void) {
+    FILE* f = fopen("replay.log", "rb");
+    if (f == NULL) {
+        SDL_setenv("PICO_INPUT_RECORD", "replay.log", 0);
+    } else {
+        fclose(f);
+        SDL_setenv("PICO_INPUT_REPLAY", "replay.log", 0);
+    }
+    pico_init(1);
+    pico_set_title((f == NULL) ? "Replay: recording" : "Replay: replaying");
+    pico_set_expert(1);
+
+    puts("draws a pixel on each click, waiting then polling");
+    Uint32 t0 = pico_get_ticks();
+    Uint32 old = t0;
+    int n = 0;
+    while (pico_get_ticks() - t0 < 3000) {
+        Uint32 now = pico_get_ticks();
+        assert(now >= old);     // also in virtual time
+        old = now;
+        Pico_Event e;
+        int ok;
+        if (now - t0 < 1500) {
+            ok = pico_input_event_timeout(&e, PICO_MOUSEBUTTONDOWN, 16);
+        } else {
+            ok = pico_input_event_ask(&e, PICO_MOUSEBUTTONDOWN);
+            pico_input_delay(16);
+        }
+        if (ok) {
+            pico_output_draw_pixel((Pico_Pos){e.button.x, e.button.y});
+            printf("%5u: click (%d,%d)\n", pico_get_ticks()-t0, e.button.x, e.button.y);
+            n++;
+        }
+        pico_output_present();
+    }
+    printf("%d clicks\n", n);
+
+    // nothing is recorded past the loop, so the log ends in this delay,
+    // and time goes on from where it was
+    if (f != NULL) {
+        Uint32 t1 = pico_get_ticks();
+        assert(t1 >= old);
+        pico_input_delay(100);
+        assert(pico_get_ticks() >= t1+100);
+    }
+
+    pico_init(0);
+    return 0;
+}
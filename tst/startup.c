@@ -0,0 +1,22 @@
+#include "pico.h"
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Startup");
+
+    Pico_Stats s = pico_get_stats();
+    printf("video: %d us\n", s.init.video);
+    assert(s.init.audio == 0);
+    assert(s.init.font == 0);
+
+    puts("opens the font on first text");
+    pico_output_draw_text(pico_pos(50, 50), "startup");
+    s = pico_get_stats();
+    printf("font: %d us\n", s.init.font);
+    assert(s.init.font > 0);
+    assert(s.init.audio == 0);
+
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "pico.h"
+
+// run with PICO_THREAD=1 to render each frame while the next one is updated
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("Thread");
+    pico_set_expert(1);
+
+    Uint32 t0 = pico_get_ticks();
+    for (int i=0; i<100; i++) {
+        // simulates some work before each frame
+        volatile int acc = 0;
+        for (int j=0; j<200000; j++) {
+            acc += j;
+        }
+        pico_output_clear();
+        pico_output_draw_rect((Pico_Rect){i%64, 32, 8, 8});
+        pico_output_draw_text((Pico_Pos){32, 10}, "thread");
+        pico_output_present();
+    }
+    printf("100 frames in %d ms\n", pico_get_ticks()-t0);
+    assert(pico_get_stats().frames >= 100);
+
+    pico_set_expert(0);
+    pico_input_event(NULL, PICO_KEYDOWN);
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,23 @@
+#include "pico.h"
+
+// edit open.png or start.wav while this runs:
+//  PICO_WATCH=1 ./watch
+
+int main (void) {
+    if (SDL_getenv("PICO_WATCH") == NULL) {
+        SDL_setenv("PICO_WATCH", "1", 0);
+    }
+    pico_init(1);
+    pico_set_title("Watch");
+
+    puts("redraws every second until a key is pressed");
+    while (!pico_input_event_timeout(NULL, PICO_KEYDOWN, 1000)) {
+        pico_output_clear();
+        pico_output_draw_image(pico_pos(30, 50), "open.png");
+        pico_output_draw_image(pico_pos(70, 50), "./open.png");  // same file
+        pico_output_sound("start.wav");
+    }
+
+    pico_init(0);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "pico.h"
+#include "world.h"
+
+// 10k moving rectangles: all colliding pairs per frame, with the world and
+// with pico_rect_vs_rect over every pair
+
+#define N 10000
+
+static Pico_Rect rs[N];
+static Pico_Pos  vs[N];
+static int pairs[N*8][2];
+
+static Uint64 usecs (Uint64 t0) {
+    return (SDL_GetPerformanceCounter()-t0) * 1000000 / SDL_GetPerformanceFrequency();
+}
+
+int main (void) {
+    pico_init(1);
+    pico_set_title("World");
+    pico_set_size((Pico_Dim){640,640}, (Pico_Dim){640,640});
+    pico_set_expert(1);
+
+    pico_world* w = pico_world_create(8);
+    Pico_Anchor a = { PICO_CENTER, PICO_MIDDLE };
+    for (int i=0; i<N; i++) {
+        rs[i] = (Pico_Rect) { rand()%640, rand()%640, 2+rand()%4, 2+rand()%4 };
+        vs[i] = (Pico_Pos)  { rand()%3-1, rand()%3-1 };
+        assert(pico_world_add(w, rs[i], a) == i);
+    }
+
+    puts("naive, one frame");
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    int naive = 0;
+    for (int i=0; i<N; i++) {
+        for (int j=i+1; j<N; j++) {
+            naive += pico_rect_vs_rect_ext(rs[i], a, rs[j], a);
+        }
+    }
+    printf("pairs=%d time=%lluus\n", naive, (unsigned long long)usecs(t0));
+    int n = pico_world_pairs(w, pairs, N*8);
+    assert(n == naive);
+
+    puts("world, 300 frames");
+    Uint64 move=0, find=0;
+    for (int f=0; f<300; f++) {
+        t0 = SDL_GetPerformanceCounter();
+        for (int i=0; i<N; i++) {
+            rs[i].x = (rs[i].x + vs[i].x + 640) % 640;
+            rs[i].y = (rs[i].y + vs[i].y + 640) % 640;
+            pico_world_set(w, i, rs[i], a);
+        }
+        move += usecs(t0);
+        t0 = SDL_GetPerformanceCounter();
+        n = pico_world_pairs(w, pairs, N*8);
+        find += usecs(t0);
+
+        pico_output_clear();
+        pico_set_color_draw((Pico_Color){0xFF,0x00,0x00,0xFF});
+        for (int i=0; i<n && i<N*8; i++) {
+            pico_output_draw_pixel((Pico_Pos){rs[pairs[i][0]].x, rs[pairs[i][0]].y});
+        }
+        pico_output_present();
+    }
+    printf("set=%lluus pairs=%lluus per frame\n",
+           (unsigned long long)(move/300), (unsigned long long)(find/300));
+
+    int ids[N];
+    n = pico_world_query(w, (Pico_Rect){0,0,100,100}, (Pico_Anchor){0,0}, ids, N);
+    printf("%d in the top-left corner\n", n);
+
+    pico_world_destroy(w);
+    pico_init(0);
+    return 0;
+}
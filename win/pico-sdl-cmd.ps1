@@ -12,7 +12,7 @@ $EXE = [System.IO.Path]::GetFileNameWithoutExtension($SRC)
 
 # Compile the source file
 gcc -Wall -o "$DIR\$EXE.exe" "$SRC" `
-    "$PICO\src\pico.c" "$PICO\src\dir.c" "$PICO\src\hash.c" `
+    "$PICO\src\pico.c" "$PICO\src\dir.c" "$PICO\src\hash.c" "$PICO\src\pak.c" "$PICO\src\world.c" `
     -I "$PICO\src" `
     -DSDL_MAIN_HANDLED -lmingw32 -lSDL2main -lSDL2 -lSDL2_gfx -lSDL2_image -lSDL2_ttf -lSDL2_mixer
 